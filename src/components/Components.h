@@ -62,6 +62,9 @@ struct Spacecraft {
     bool isAttacking = false;
     float lastShotTime = 0.0F;
     EntityID targetEntity = INVALID_ENTITY; // Target entity to pursue and attack
+    std::uint32_t flowFieldId = 0; // Shared flow field for move orders (0 = steer directly)
+    bool isAsleep = false; // Settled ships skip movement and separation until disturbed
+    float restTime = 0.0F; // Time since the ship was last pushed by a neighbor
     
     // AI state machine for enemy units
     AIState aiState = AIState::Search;
@@ -95,19 +98,6 @@ struct Planet {
     static constexpr float SPACECRAFT_BUILD_TIME = 5.0F;
 };
 
-/**
- * @brief Component for projectile entities
- */
-struct Projectile {
-    float directionX = 0.0F;
-    float directionY = 0.0F;
-    float speed = 2.0F;
-    float lifetime = 3.0F;
-    std::uint32_t ownerId = 0;
-    std::uint32_t targetId = INVALID_ENTITY; // Specific target entity ID
-    bool isActive = true;
-};
-
 /**
  * @brief Component for entities that can be selected
  */
@@ -25,8 +25,6 @@ void ECSRegistry::DestroyEntity(EntityID entity) {
     for (auto& [typeIndex, storage] : mComponents) {
         storage.erase(entity);
     }
-
-    mDestroyedEntities.push_back(entity);
 }
 
 auto ECSRegistry::GetComponentStorage(std::type_index type) -> std::unordered_map<EntityID, std::unique_ptr<void, void(*)(void*)>>& {
@@ -99,7 +99,6 @@ private:
     
     // Entity management
     EntityID mNextEntityID;
-    std::vector<EntityID> mDestroyedEntities;
 
     /**
      * @brief Get or create component storage for a type
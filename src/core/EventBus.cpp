@@ -0,0 +1,12 @@
+#include "EventBus.h"
+#include <utility>
+
+void EventBus::Subscribe(GameEventType type, Listener listener) {
+    mListeners[static_cast<std::size_t>(type)].push_back(std::move(listener));
+}
+
+void EventBus::Publish(const GameEvent& event) const {
+    for (const auto& listener : mListeners[static_cast<std::size_t>(event.type)]) {
+        listener(event);
+    }
+}
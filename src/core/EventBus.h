@@ -0,0 +1,55 @@
+#pragma once
+
+#include "ECSRegistry.h"
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+/**
+ * @brief Types of gameplay events broadcast between systems
+ */
+enum class GameEventType : std::uint8_t {
+    EntitySpawned,   // A new unit entered the world
+    EntityDied,      // A unit or planet was destroyed
+    EntityDamaged,   // A unit or planet lost health and survived
+    Count
+};
+
+/**
+ * @brief Payload for a gameplay event
+ */
+struct GameEvent {
+    GameEventType type = GameEventType::EntitySpawned;
+    EntityID entity = INVALID_ENTITY;
+    float posX = 0.0F;
+    float posY = 0.0F;
+};
+
+/**
+ * @brief Simple synchronous publish/subscribe bus
+ *
+ * Systems publish events as they happen and listeners are invoked
+ * immediately, in subscription order. Listeners must not publish events
+ * of the same type recursively.
+ */
+class EventBus {
+public:
+    using Listener = std::function<void(const GameEvent&)>;
+
+    /**
+     * @brief Register a listener for an event type
+     * @param type Event type to listen for
+     * @param listener Callback invoked for every published event of that type
+     */
+    void Subscribe(GameEventType type, Listener listener);
+
+    /**
+     * @brief Dispatch an event to all listeners of its type
+     * @param event Event to publish
+     */
+    void Publish(const GameEvent& event) const;
+
+private:
+    std::array<std::vector<Listener>, static_cast<std::size_t>(GameEventType::Count)> mListeners;
+};
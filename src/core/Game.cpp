@@ -1,7 +1,12 @@
 #include "Game.h"
 #include "../components/Components.h"
+#include "EventBus.h"
+#include "ProjectilePool.h"
 #include "../rendering/Renderer.h"
 #include "../systems/MovementSystem.h"
+#include "../systems/FlowFieldSystem.h"
+#include "../systems/LifecycleSystem.h"
+#include "../systems/SpatialIndexSystem.h"
 #include "../systems/CollisionSystem.h"
 #include "../systems/CombatSystem.h"
 #include "GameStateManager.h"
@@ -9,19 +14,28 @@
 #include "../rendering/AudioManager.h"
 #include "../gameplay/GameplaySystem.h"
 #include "../ui/UISystem.h"
+#include "../rendering/FrameCapture.h"
 #include <SDL2/SDL_log.h>
 #include <GL/gl.h>
 #include <algorithm>
+#include <cstdlib>
 
 namespace Core {
 
 Game::Game()
-    : mWindow(nullptr)
+    : Game(GameOptions())
+{
+}
+
+Game::Game(const GameOptions& options)
+    : mOptions(options)
+    , mFrameIndex(0)
+    , mWindow(nullptr)
     , mGLContext(nullptr)
     , mRunning(false)
     , mLastFrameTime(0)
-    , mWindowWidth(DEFAULT_WINDOW_WIDTH)
-    , mWindowHeight(DEFAULT_WINDOW_HEIGHT)
+    , mWindowWidth(options.windowWidth)
+    , mWindowHeight(options.windowHeight)
 {
 }
 
@@ -32,6 +46,11 @@ Game::~Game() {
 bool Game::Initialize() {
     SDL_Log("Initializing Space RTS Game Engine...");
 
+    // Build boxes have no sound card; keep any driver the caller chose explicitly
+    if (mOptions.headless) {
+        SDL_setenv("SDL_AUDIODRIVER", "dummy", 0);
+    }
+
     // Initialize SDL
     if (SDL_Init(SDL_INIT_VIDEO | SDL_INIT_AUDIO) < 0) {
         SDL_Log("Failed to initialize SDL: %s", SDL_GetError());
@@ -45,7 +64,7 @@ bool Game::Initialize() {
         SDL_WINDOWPOS_CENTERED,
         mWindowWidth,
         mWindowHeight,
-        SDL_WINDOW_OPENGL | SDL_WINDOW_RESIZABLE
+        mOptions.headless ? (SDL_WINDOW_OPENGL | SDL_WINDOW_HIDDEN) : (SDL_WINDOW_OPENGL | SDL_WINDOW_RESIZABLE)
     );
 
     if (!mWindow) {
@@ -60,13 +79,18 @@ bool Game::Initialize() {
         return false;
     }
 
-    // Enable VSync
-    SDL_GL_SetSwapInterval(1);
+    // Enable VSync, except when measuring headless render times
+    SDL_GL_SetSwapInterval(mOptions.headless ? 0 : 1);
+
+    std::srand(mOptions.seed);
 
     // Initialize subsystems
     mECS = std::make_unique<ECSRegistry>();
+    mEventBus = std::make_unique<EventBus>();
+    mProjectilePool = std::make_unique<ProjectilePool>();
     mRenderer = std::make_unique<Renderer>(*mECS);
     mMovementSystem = std::make_unique<MovementSystem>(*mECS);
+    mFlowFieldSystem = std::make_unique<FlowFieldSystem>(*mECS);
     mCollisionSystem = std::make_unique<CollisionSystem>(*mECS);
     mCombatSystem = std::make_unique<CombatSystem>(*mECS);
     mGameStateManager = std::make_unique<GameStateManager>();
@@ -74,6 +98,8 @@ bool Game::Initialize() {
     mAudioManager = std::make_unique<AudioManager>();
     mGameplaySystem = std::make_unique<GameplaySystem>(*mECS);
     mUISystem = std::make_unique<UISystem>(*mECS);
+    mLifecycleSystem = std::make_unique<LifecycleSystem>(*mECS);
+    mSpatialIndexSystem = std::make_unique<SpatialIndexSystem>(*mECS);
 
     // Initialize all subsystems
     if (!mRenderer->Initialize(mWindowWidth, mWindowHeight)) {
@@ -81,11 +107,24 @@ bool Game::Initialize() {
         return false;
     }
 
+    if (mOptions.headless) {
+        mFrameCapture = std::make_unique<FrameCapture>();
+        if (!mFrameCapture->Initialize(mWindowWidth, mWindowHeight, mOptions.captureDirectory)) {
+            SDL_Log("Failed to initialize frame capture");
+            return false;
+        }
+    }
+
     if (!mMovementSystem->Initialize()) {
         SDL_Log("Failed to initialize movement system");
         return false;
     }
 
+    if (!mFlowFieldSystem->Initialize()) {
+        SDL_Log("Failed to initialize flow field system");
+        return false;
+    }
+
     if (!mCollisionSystem->Initialize()) {
         SDL_Log("Failed to initialize collision system");
         return false;
@@ -116,14 +155,39 @@ bool Game::Initialize() {
         return false;
     }
 
+    if (!mLifecycleSystem->Initialize()) {
+        SDL_Log("Failed to initialize lifecycle system");
+        return false;
+    }
+
+    if (!mSpatialIndexSystem->Initialize()) {
+        SDL_Log("Failed to initialize spatial index system");
+        return false;
+    }
+
     // Connect subsystems that need cross-system communication
     mCombatSystem->SetAudioManager(mAudioManager.get());
-    mCollisionSystem->SetAudioManager(mAudioManager.get());
+    mCombatSystem->SetEventBus(mEventBus.get());
+    mCollisionSystem->SetEventBus(mEventBus.get());
+    mGameplaySystem->SetEventBus(mEventBus.get());
+    mUISystem->SetEventBus(mEventBus.get());
+    mInputSystem->SetEventBus(mEventBus.get());
+    mAudioManager->SetEventBus(mEventBus.get());
+    mAudioManager->SetCamera(&mRenderer->GetCamera());
+    mLifecycleSystem->SetEventBus(mEventBus.get());
+    mCombatSystem->SetProjectilePool(mProjectilePool.get());
+    mMovementSystem->SetProjectilePool(mProjectilePool.get());
+    mCollisionSystem->SetProjectilePool(mProjectilePool.get());
+    mRenderer->SetProjectilePool(mProjectilePool.get());
+    mRenderer->SetSpatialIndex(mSpatialIndexSystem.get());
     mInputSystem->SetGameStateManager(mGameStateManager.get());
     mGameplaySystem->SetGameStateManager(mGameStateManager.get());
     mInputSystem->SetRenderer(mRenderer.get());
     mInputSystem->SetUISystem(mUISystem.get());
     mInputSystem->SetGameplaySystem(mGameplaySystem.get());
+    mInputSystem->SetFlowFieldSystem(mFlowFieldSystem.get());
+    mInputSystem->SetSpatialIndex(mSpatialIndexSystem.get());
+    mMovementSystem->SetFlowFieldSystem(mFlowFieldSystem.get());
     mUISystem->SetRenderer(mRenderer.get());
     mUISystem->SetGameStateManager(mGameStateManager.get());
     
@@ -140,6 +204,8 @@ bool Game::Initialize() {
 void Game::Run() {
     SDL_Log("Starting main game loop...");
     
+    const double ticksPerMs = static_cast<double>(SDL_GetPerformanceFrequency()) / 1000.0;
+    
     while (mRunning) {
         std::uint32_t currentTime = SDL_GetTicks();
         float deltaTime = static_cast<float>(currentTime - mLastFrameTime) / 1000.0F;
@@ -148,13 +214,35 @@ void Game::Run() {
         // Cap delta time to prevent large jumps
         deltaTime = std::min(deltaTime, 1.0F / 30.0F);
 
+        // Headless runs step a fixed amount so captures are reproducible
+        if (mOptions.headless) {
+            deltaTime = 1.0F / TARGET_FPS;
+        }
+
+        std::uint64_t updateStart = SDL_GetPerformanceCounter();
         ProcessEvents();
         Update(deltaTime);
+        std::uint64_t renderStart = SDL_GetPerformanceCounter();
         Render();
+        std::uint64_t renderEnd = SDL_GetPerformanceCounter();
+        ++mFrameIndex;
+
+        if (mFrameCapture) {
+            mFrameCapture->RecordTiming(mFrameIndex,
+                                        static_cast<double>(renderStart - updateStart) / ticksPerMs,
+                                        static_cast<double>(renderEnd - renderStart) / ticksPerMs);
+            if (mOptions.snapshotInterval > 0 && mFrameIndex % mOptions.snapshotInterval == 0) {
+                mFrameCapture->WriteSnapshot(mFrameIndex);
+            }
+        }
+
+        if (mOptions.frameLimit > 0 && mFrameIndex >= mOptions.frameLimit) {
+            RequestShutdown();
+        }
 
         // Frame rate limiting
         std::uint32_t frameTime = SDL_GetTicks() - currentTime;
-        if (frameTime < FRAME_TIME_MS) {
+        if (!mOptions.headless && frameTime < FRAME_TIME_MS) {
             SDL_Delay(static_cast<std::uint32_t>(FRAME_TIME_MS - frameTime));
         }
     }
@@ -190,20 +278,40 @@ void Game::Update(float deltaTime) {
     
     // Update all systems in order
     mInputSystem->Update(deltaTime);
+    mFlowFieldSystem->Update(deltaTime);
     mMovementSystem->Update(deltaTime);
     mCollisionSystem->Update(deltaTime);
     mCombatSystem->Update(deltaTime);
     mGameplaySystem->Update(deltaTime);
     mUISystem->Update(deltaTime);
+    
+    // Reclaim units that died this frame once every system has seen them
+    mLifecycleSystem->Update(deltaTime);
+    
+    // Index the surviving units for rendering and picking
+    mSpatialIndexSystem->Update(deltaTime);
+    
+    // Hand the finished frame to the renderer; nothing below reads the registry for world drawing
+    mRenderer->ExtractSnapshot();
 }
 
 void Game::Render() {
+    if (mFrameCapture) {
+        mFrameCapture->BindTarget();
+    }
+    
     mRenderer->BeginFrame();
     mRenderer->RenderWorld();
     mUISystem->RenderUI(); // Render UI elements
     mRenderer->RenderUI(); // Render any additional renderer UI
     mRenderer->EndFrame();
     
+    // Nothing is presented offscreen; wait for the GPU so the frame time is honest
+    if (mFrameCapture) {
+        glFinish();
+        return;
+    }
+    
     SDL_GL_SwapWindow(mWindow);
 }
 
@@ -211,11 +319,16 @@ void Game::Shutdown() {
     SDL_Log("Shutting down game engine...");
     
     // Cleanup subsystems in reverse order
+    mSpatialIndexSystem.reset();
+    mLifecycleSystem.reset();
     mUISystem.reset();
     mGameplaySystem.reset();
     mAudioManager.reset();
     mInputSystem.reset();
     mRenderer.reset();
+    mFrameCapture.reset();
+    mProjectilePool.reset();
+    mEventBus.reset();
     mECS.reset();
 
     // Cleanup SDL resources
@@ -3,11 +3,18 @@
 #include <SDL2/SDL.h>
 #include <memory>
 #include <cstdint>
+#include <string>
 
 // Forward declarations
 class ECSRegistry;
+class EventBus;
+class ProjectilePool;
 class Renderer;
 class MovementSystem;
+class FlowFieldSystem;
+class LifecycleSystem;
+class SpatialIndexSystem;
+class FrameCapture;
 class CollisionSystem;
 class CombatSystem;
 class GameStateManager;
@@ -18,6 +25,19 @@ class UISystem;
 
 namespace Core {
 
+/**
+ * @brief Launch options, normally parsed from the command line
+ */
+struct GameOptions {
+    int windowWidth = 1600;
+    int windowHeight = 1200;
+    bool headless = false;              // Hidden window, offscreen target, fixed timestep, no frame pacing
+    std::uint32_t frameLimit = 0;       // Exit after this many frames; 0 runs until quit
+    std::uint32_t snapshotInterval = 0; // Headless only: write an image every N frames; 0 disables
+    std::string captureDirectory = "."; // Headless only: where snapshots and timings go
+    std::uint32_t seed = 1;             // Seed for spawn randomness, so runs are reproducible
+};
+
 /**
  * @brief Main game class that orchestrates all game systems
  * 
@@ -27,6 +47,7 @@ namespace Core {
 class Game {
 public:
     Game();
+    explicit Game(const GameOptions& options);
     ~Game();
 
     // Non-copyable
@@ -62,8 +83,11 @@ public:
 
     // Getters for subsystems
     ECSRegistry& GetECS() { return *mECS; }
+    EventBus& GetEventBus() { return *mEventBus; }
+    ProjectilePool& GetProjectilePool() { return *mProjectilePool; }
     Renderer& GetRenderer() { return *mRenderer; }
     MovementSystem& GetMovementSystem() { return *mMovementSystem; }
+    FlowFieldSystem& GetFlowFieldSystem() { return *mFlowFieldSystem; }
     CollisionSystem& GetCollisionSystem() { return *mCollisionSystem; }
     CombatSystem& GetCombatSystem() { return *mCombatSystem; }
     GameStateManager& GetGameStateManager() { return *mGameStateManager; }
@@ -71,12 +95,18 @@ public:
     AudioManager& GetAudioManager() { return *mAudioManager; }
     GameplaySystem& GetGameplaySystem() { return *mGameplaySystem; }
     UISystem& GetUISystem() { return *mUISystem; }
+    LifecycleSystem& GetLifecycleSystem() { return *mLifecycleSystem; }
+    SpatialIndexSystem& GetSpatialIndexSystem() { return *mSpatialIndexSystem; }
 
 private:
     void ProcessEvents();
     void Update(float deltaTime);
     void Render();
 
+    // Launch configuration
+    GameOptions mOptions;
+    std::uint32_t mFrameIndex;
+
     // Core SDL resources
     SDL_Window* mWindow;
     SDL_GLContext mGLContext;
@@ -91,8 +121,11 @@ private:
     
     // Subsystems (using composition)
     std::unique_ptr<ECSRegistry> mECS;
+    std::unique_ptr<EventBus> mEventBus;
+    std::unique_ptr<ProjectilePool> mProjectilePool;
     std::unique_ptr<Renderer> mRenderer;
     std::unique_ptr<MovementSystem> mMovementSystem;
+    std::unique_ptr<FlowFieldSystem> mFlowFieldSystem;
     std::unique_ptr<CollisionSystem> mCollisionSystem;
     std::unique_ptr<CombatSystem> mCombatSystem;
     std::unique_ptr<GameStateManager> mGameStateManager;
@@ -100,10 +133,11 @@ private:
     std::unique_ptr<AudioManager> mAudioManager;
     std::unique_ptr<GameplaySystem> mGameplaySystem;
     std::unique_ptr<UISystem> mUISystem;
+    std::unique_ptr<LifecycleSystem> mLifecycleSystem;
+    std::unique_ptr<SpatialIndexSystem> mSpatialIndexSystem;
+    std::unique_ptr<FrameCapture> mFrameCapture; // Headless runs only
 
     // Configuration constants
-    static constexpr int DEFAULT_WINDOW_WIDTH = 1600;
-    static constexpr int DEFAULT_WINDOW_HEIGHT = 1200;
     static constexpr float TARGET_FPS = 60.0F;
     static constexpr float FRAME_TIME_MS = 1000.0F / TARGET_FPS;
 };
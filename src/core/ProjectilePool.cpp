@@ -0,0 +1,55 @@
+#include "ProjectilePool.h"
+
+ProjectilePool::ProjectilePool(std::size_t capacity)
+    : mPosX(capacity)
+    , mPosY(capacity)
+    , mDirX(capacity)
+    , mDirY(capacity)
+    , mSpeed(capacity)
+    , mLifetime(capacity)
+    , mOwner(capacity)
+    , mOwnerType(capacity)
+    , mTarget(capacity)
+    , mCount(0)
+{
+}
+
+bool ProjectilePool::Spawn(float posX, float posY, float dirX, float dirY, float speed, float lifetime,
+                           EntityID owner, Components::SpacecraftType ownerType, EntityID target) {
+    if (mCount >= Capacity()) {
+        return false;
+    }
+
+    std::size_t index = mCount++;
+    mPosX[index] = posX;
+    mPosY[index] = posY;
+    mDirX[index] = dirX;
+    mDirY[index] = dirY;
+    mSpeed[index] = speed;
+    mLifetime[index] = lifetime;
+    mOwner[index] = owner;
+    mOwnerType[index] = ownerType;
+    mTarget[index] = target;
+    return true;
+}
+
+void ProjectilePool::Remove(std::size_t index) {
+    if (index >= mCount) {
+        return;
+    }
+
+    std::size_t last = --mCount;
+    if (index == last) {
+        return;
+    }
+
+    mPosX[index] = mPosX[last];
+    mPosY[index] = mPosY[last];
+    mDirX[index] = mDirX[last];
+    mDirY[index] = mDirY[last];
+    mSpeed[index] = mSpeed[last];
+    mLifetime[index] = mLifetime[last];
+    mOwner[index] = mOwner[last];
+    mOwnerType[index] = mOwnerType[last];
+    mTarget[index] = mTarget[last];
+}
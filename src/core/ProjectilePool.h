@@ -0,0 +1,68 @@
+#pragma once
+
+#include "ECSRegistry.h"
+#include "../components/Components.h"
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief Fixed-capacity structure-of-arrays storage for projectiles
+ *
+ * Projectiles are short-lived and numerous, so they live outside the ECS in
+ * parallel arrays allocated once up front. Live projectiles are always packed
+ * into [0, Size()); removal swaps the last projectile into the freed index, so
+ * callers that remove while iterating should walk the arrays backwards.
+ */
+class ProjectilePool {
+public:
+    explicit ProjectilePool(std::size_t capacity = DEFAULT_CAPACITY);
+
+    /**
+     * @brief Add a projectile
+     * @return false if the pool is full and the shot was dropped
+     */
+    bool Spawn(float posX, float posY, float dirX, float dirY, float speed, float lifetime,
+               EntityID owner, Components::SpacecraftType ownerType, EntityID target);
+
+    /**
+     * @brief Remove the projectile at an index by swapping in the last one
+     * @param index Index in [0, Size())
+     */
+    void Remove(std::size_t index);
+
+    /**
+     * @brief Remove all projectiles
+     */
+    void Clear() { mCount = 0; }
+
+    std::size_t Size() const { return mCount; }
+    std::size_t Capacity() const { return mPosX.size(); }
+
+    // Per-projectile arrays, valid for indices in [0, Size())
+    float* GetPosX() { return mPosX.data(); }
+    float* GetPosY() { return mPosY.data(); }
+    float* GetLifetime() { return mLifetime.data(); }
+    const float* GetPosX() const { return mPosX.data(); }
+    const float* GetPosY() const { return mPosY.data(); }
+    const float* GetDirX() const { return mDirX.data(); }
+    const float* GetDirY() const { return mDirY.data(); }
+    const float* GetSpeed() const { return mSpeed.data(); }
+    const float* GetLifetime() const { return mLifetime.data(); }
+    const EntityID* GetOwner() const { return mOwner.data(); }
+    const Components::SpacecraftType* GetOwnerType() const { return mOwnerType.data(); }
+    const EntityID* GetTarget() const { return mTarget.data(); }
+
+    static constexpr std::size_t DEFAULT_CAPACITY = 4096;
+
+private:
+    std::vector<float> mPosX;
+    std::vector<float> mPosY;
+    std::vector<float> mDirX;
+    std::vector<float> mDirY;
+    std::vector<float> mSpeed;
+    std::vector<float> mLifetime;
+    std::vector<EntityID> mOwner;
+    std::vector<Components::SpacecraftType> mOwnerType; // Team of the shooter when it fired
+    std::vector<EntityID> mTarget;                       // Specific target, or INVALID_ENTITY
+    std::size_t mCount;
+};
@@ -1,5 +1,6 @@
 #include "GameplaySystem.h"
 #include "../components/Components.h"
+#include "../core/EventBus.h"
 #include "../core/GameStateManager.h"
 #include <SDL_log.h>
 #include <cstdlib>
@@ -24,6 +25,15 @@ void GameplaySystem::SetGameStateManager(GameStateManager* gameStateManager) {
     mGameStateManager = gameStateManager;
 }
 
+void GameplaySystem::SetEventBus(EventBus* eventBus) {
+    mEventBus = eventBus;
+    if (mEventBus == nullptr) {
+        return;
+    }
+    
+    mEventBus->Subscribe(GameEventType::EntityDied, [this](const GameEvent& event) { OnEntityDied(event); });
+}
+
 void GameplaySystem::ResetGameState() {
     mGameOverTriggered = false;
     SDL_Log("GameplaySystem: Game state reset for new game");
@@ -101,6 +111,21 @@ void GameplaySystem::Shutdown() {
     SDL_Log("Gameplay manager shutdown");
 }
 
+void GameplaySystem::OnEntityDied(const GameEvent& event) {
+    using namespace Components;
+    
+    if (mGameStateManager == nullptr) {
+        return;
+    }
+    
+    // Award score for destroyed enemy ships
+    auto* spacecraft = mRegistry.GetComponent<Spacecraft>(event.entity);
+    if (spacecraft && spacecraft->type == SpacecraftType::Enemy) {
+        mGameStateManager->IncrementEnemiesKilled();
+        mGameStateManager->AddScore(ENEMY_KILL_SCORE);
+    }
+}
+
 void GameplaySystem::SpawnEnemyWave() {
     using namespace Components;
     
@@ -128,6 +153,10 @@ void GameplaySystem::SpawnEnemyWave() {
         mRegistry.AddComponent<Health>(enemy, {10, 10, true});
         mRegistry.AddComponent<Selectable>(enemy, {false, 0.04F}); // Original size
         mRegistry.AddComponent<Renderable>(enemy, {1.0F, 0.2F, 0.2F, 1.0F, 1.0F});
+        
+        if (mEventBus != nullptr) {
+            mEventBus->Publish({GameEventType::EntitySpawned, enemy, spawnX, spawnY});
+        }
     }
     
     SDL_Log("Spawned wave %d: %d enemies (next spawn in %.1fs)", 
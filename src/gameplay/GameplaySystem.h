@@ -2,9 +2,12 @@
 
 #include "../core/ECSRegistry.h"
 #include "../core/SystemBase.h"
+#include <cstdint>
 
-// Forward declaration
+// Forward declarations
 class GameStateManager;
+class EventBus;
+struct GameEvent;
 
 /**
  * @brief Gameplay system
@@ -17,6 +20,9 @@ public:
     // Set the game state manager
     void SetGameStateManager(GameStateManager* gameStateManager);
     
+    // Set the event bus for spawn notifications and kill scoring
+    void SetEventBus(EventBus* eventBus);
+    
     // Game state reset for new games
     void ResetGameState();
 
@@ -30,11 +36,13 @@ private:
     static constexpr float INITIAL_SPAWN_INTERVAL = 15.0F; // seconds (increased from 10.0F)
     static constexpr float MIN_SPAWN_INTERVAL = 4.0F; // increased from 2.0F
     static constexpr float SPAWN_INTERVAL_DECREASE = 0.9F; // slower decrease (was 0.85F)
+    static constexpr std::uint32_t ENEMY_KILL_SCORE = 10;
     
     // Private methods
     void SpawnEnemyWave();
     void UpdatePlanetStates();
     void CheckGameOverCondition();
+    void OnEntityDied(const GameEvent& event);
     
     // Game state
     float mSurvivalTime;
@@ -45,4 +53,7 @@ private:
     
     // Game state manager
     GameStateManager* mGameStateManager;
+    
+    // Event integration
+    EventBus* mEventBus = nullptr;
 };
@@ -1,9 +1,13 @@
 #include "InputSystem.h"
 #include "../components/Components.h"
+#include "../core/EventBus.h"
 #include "../core/GameStateManager.h"
 #include "../gameplay/GameplaySystem.h"
+#include "../systems/FlowFieldSystem.h"
+#include "../systems/SpatialIndexSystem.h"
 #include "../rendering/Renderer.h"
 #include "../ui/UISystem.h"
+#include "../utils/FormationPlanner.h"
 #include <SDL2/SDL_events.h>
 #include <SDL2/SDL_mouse.h>
 #include <SDL2/SDL_keyboard.h>
@@ -24,6 +28,7 @@ InputSystem::InputSystem(ECSRegistry& registry)
     , mDragEndX(0)
     , mDragEndY(0)
     , mSelectedPlanet(INVALID_ENTITY)
+    , mControlGroups()
     , mGameStateManager(nullptr)
     , mGameplaySystem(nullptr)
 {
@@ -33,16 +38,44 @@ InputSystem::~InputSystem() {
     Shutdown();
 }
 
+void InputSystem::SetEventBus(EventBus* eventBus) {
+    if (eventBus == nullptr) {
+        return;
+    }
+    
+    eventBus->Subscribe(GameEventType::EntityDied, [this](const GameEvent& event) { OnEntityDied(event); });
+}
+
 bool InputSystem::Initialize() {
     SDL_Log("Input manager initialized");
     return true;
 }
 
 void InputSystem::Update(float deltaTime) {
-    (void)deltaTime; // Suppress unused parameter warning
+    if (mRenderer == nullptr) {
+        return;
+    }
     
-    // Clean up dead entities from selection
-    CleanupDeadEntitiesFromSelection();
+    // Arrow keys pan the camera at a constant on-screen speed
+    Camera& camera = mRenderer->GetCamera();
+    float panStep = CAMERA_PAN_SPEED * deltaTime / camera.GetZoom();
+    float panX = 0.0F;
+    float panY = 0.0F;
+    if (IsKeyPressed(SDL_SCANCODE_LEFT)) {
+        panX -= panStep;
+    }
+    if (IsKeyPressed(SDL_SCANCODE_RIGHT)) {
+        panX += panStep;
+    }
+    if (IsKeyPressed(SDL_SCANCODE_DOWN)) {
+        panY -= panStep;
+    }
+    if (IsKeyPressed(SDL_SCANCODE_UP)) {
+        panY += panStep;
+    }
+    if (panX != 0.0F || panY != 0.0F) {
+        camera.Pan(panX, panY);
+    }
 }
 
 void InputSystem::Shutdown() {
@@ -63,6 +96,9 @@ void InputSystem::ProcessEvent(const SDL_Event& event) {
         case SDL_MOUSEMOTION:
             HandleMouseMotion(event.motion);
             break;
+        case SDL_MOUSEWHEEL:
+            HandleMouseWheel(event.wheel);
+            break;
         case SDL_KEYDOWN:
             HandleKeyDown(event.key);
             break;
@@ -94,6 +130,11 @@ void InputSystem::GetMousePosition(int& mouseX, int& mouseY) const {
 }
 
 std::pair<float, float> InputSystem::ScreenToWorld(int screenX, int screenY, int windowWidth, int windowHeight) const {
+    // Clicks land wherever the camera is looking
+    if (mRenderer != nullptr) {
+        return mRenderer->GetCamera().ScreenToWorld(screenX, screenY);
+    }
+    
     float worldX = (static_cast<float>(screenX) / static_cast<float>(windowWidth)) * WORLD_X_SCALE - WORLD_X_OFFSET;
     float worldY = -((static_cast<float>(screenY) / static_cast<float>(windowHeight)) * WORLD_Y_SCALE - WORLD_Y_OFFSET);
     return {worldX, worldY};
@@ -164,6 +205,16 @@ void InputSystem::HandleMouseMotion(const SDL_MouseMotionEvent& event) {
     }
 }
 
+void InputSystem::HandleMouseWheel(const SDL_MouseWheelEvent& event) {
+    if (mRenderer == nullptr || event.y == 0) {
+        return;
+    }
+    
+    // Zoom toward the cursor so the point under it stays put
+    float factor = event.y > 0 ? CAMERA_ZOOM_STEP : 1.0F / CAMERA_ZOOM_STEP;
+    mRenderer->GetCamera().ZoomAt(mMouseX, mMouseY, factor);
+}
+
 void InputSystem::HandleKeyDown(const SDL_KeyboardEvent& event) {
     if (event.keysym.scancode < mKeyStates.size()) {
         mKeyStates[event.keysym.scancode] = true;
@@ -180,7 +231,10 @@ void InputSystem::HandleKeyDown(const SDL_KeyboardEvent& event) {
                 }
                 SDL_Log("Game restart requested from game over screen");
             } else {
-                mSelectedEntities.clear();
+                ClearShipSelection();
+                if (mUISystem != nullptr) {
+                    mUISystem->UpdateSelectedCount(0);
+                }
             }
             break;
         case SDLK_SPACE:
@@ -193,23 +247,47 @@ void InputSystem::HandleKeyDown(const SDL_KeyboardEvent& event) {
                 }
             }
             break;
+        case SDLK_HOME:
+            // Recenter the camera on the original play area
+            if (mRenderer != nullptr) {
+                mRenderer->GetCamera().Reset();
+            }
+            break;
+        case SDLK_1:
+        case SDLK_2:
+        case SDLK_3:
+        case SDLK_4:
+        case SDLK_5:
+        case SDLK_6:
+        case SDLK_7:
+        case SDLK_8:
+        case SDLK_9:
+            // Ctrl+number saves the selection, number alone restores it; held keys do not repeat
+            if (event.repeat == 0) {
+                int group = static_cast<int>(event.keysym.sym - SDLK_0);
+                if (IsKeyPressed(SDL_SCANCODE_LCTRL) || IsKeyPressed(SDL_SCANCODE_RCTRL)) {
+                    AssignControlGroup(group);
+                } else {
+                    RecallControlGroup(group);
+                }
+            }
+            break;
         case SDLK_a:
             if (IsKeyPressed(SDL_SCANCODE_LCTRL) || IsKeyPressed(SDL_SCANCODE_RCTRL)) {
                 // Select all player units that are alive
                 using namespace Components;
                 ClearAllSelections();
-                mSelectedEntities.clear();
                 mRegistry.ForEach<Spacecraft>([&](EntityID entity, const Spacecraft& spacecraft) {
                     auto* health = mRegistry.GetComponent<Health>(entity);
                     if (spacecraft.type == SpacecraftType::Player && health && health->isAlive) {
-                        mSelectedEntities.push_back(entity);
+                        mSelectedEntities.Add(entity);
                         SetEntitySelected(entity, true);
                     }
                 });
                 
                 // Update UI with new selection count
                 if (mUISystem != nullptr) {
-                    mUISystem->UpdateSelectedCount(static_cast<int>(mSelectedEntities.size()));
+                    mUISystem->UpdateSelectedCount(static_cast<int>(mSelectedEntities.Size()));
                 }
             }
             break;
@@ -246,31 +324,25 @@ void InputSystem::HandleSelection(int mouseX, int mouseY, bool isCtrlHeld) {
         if (!isCtrlHeld) {
             // Clear previous selections
             ClearAllSelections();
-            mSelectedEntities.clear();
         }
         
         // Toggle selection
-        auto iterator = std::find(mSelectedEntities.begin(), mSelectedEntities.end(), clickedEntity);
-        if (iterator != mSelectedEntities.end()) {
-            // Deselect
-            mSelectedEntities.erase(iterator);
+        if (mSelectedEntities.Remove(clickedEntity)) {
             SetEntitySelected(clickedEntity, false);
         } else {
-            // Select
-            mSelectedEntities.push_back(clickedEntity);
+            mSelectedEntities.Add(clickedEntity);
             SetEntitySelected(clickedEntity, true);
         }
         
-        SDL_Log("Selected %zu units", mSelectedEntities.size());
+        SDL_Log("Selected %zu units", mSelectedEntities.Size());
         
         // Update UI with new selection count
         if (mUISystem != nullptr) {
-            mUISystem->UpdateSelectedCount(static_cast<int>(mSelectedEntities.size()));
+            mUISystem->UpdateSelectedCount(static_cast<int>(mSelectedEntities.Size()));
         }
     } else if (clickedPlanet != INVALID_ENTITY) {
         // Clear ship selections when selecting planets
         ClearAllSelections();
-        mSelectedEntities.clear();
         
         // Select planet
         SetPlanetSelected(mSelectedPlanet, false); // Clear old selection
@@ -286,7 +358,6 @@ void InputSystem::HandleSelection(int mouseX, int mouseY, bool isCtrlHeld) {
     } else if (!isCtrlHeld) {
         // Clear all selections including planet selection
         ClearAllSelections();
-        mSelectedEntities.clear();
         
         // Clear planet selection and hide UI
         SetPlanetSelected(mSelectedPlanet, false);
@@ -319,27 +390,24 @@ void InputSystem::HandleBoxSelection(int startX, int startY, int endX, int endY)
     
     if (!IsKeyPressed(SDL_SCANCODE_LCTRL) && !IsKeyPressed(SDL_SCANCODE_RCTRL)) {
         ClearAllSelections();
-        mSelectedEntities.clear();
     }
     
     for (EntityID entity : entitiesInBox) {
-        auto it = std::find(mSelectedEntities.begin(), mSelectedEntities.end(), entity);
-        if (it == mSelectedEntities.end()) {
-            mSelectedEntities.push_back(entity);
+        if (mSelectedEntities.Add(entity)) {
             SetEntitySelected(entity, true);
         }
     }
     
-    SDL_Log("Box selected %zu units", mSelectedEntities.size());
+    SDL_Log("Box selected %zu units", mSelectedEntities.Size());
     
     // Update UI with new selection count
     if (mUISystem != nullptr) {
-        mUISystem->UpdateSelectedCount(static_cast<int>(mSelectedEntities.size()));
+        mUISystem->UpdateSelectedCount(static_cast<int>(mSelectedEntities.Size()));
     }
 }
 
 void InputSystem::HandleMovement(int mouseX, int mouseY) {
-    if (mSelectedEntities.empty()) {
+    if (mSelectedEntities.IsEmpty()) {
         return;
     }
     
@@ -360,6 +428,7 @@ void InputSystem::HandleMovement(int mouseX, int mouseY) {
             if (auto* spacecraft = mRegistry.GetComponent<Spacecraft>(entity)) {
                 if (spacecraft->type == SpacecraftType::Player) {
                     spacecraft->targetEntity = enemyTarget; // Set the target to pursue
+                    spacecraft->flowFieldId = FlowFieldSystem::INVALID_FIELD;
                     spacecraft->isMoving = true;
                     spacecraft->isAttacking = true;
                     SDL_Log("Unit %u ordered to attack and pursue enemy %u (smart-click)", entity, enemyTarget);
@@ -368,23 +437,12 @@ void InputSystem::HandleMovement(int mouseX, int mouseY) {
         }
     } else {
         // Right-clicked on empty space - normal move command
-        using namespace Components;
-        for (EntityID entity : mSelectedEntities) {
-            if (auto* spacecraft = mRegistry.GetComponent<Spacecraft>(entity)) {
-                if (spacecraft->type == SpacecraftType::Player) {
-                    spacecraft->destX = worldX;
-                    spacecraft->destY = worldY;
-                    spacecraft->isMoving = true;
-                    spacecraft->isAttacking = false; // Clear attack mode
-                    spacecraft->targetEntity = INVALID_ENTITY; // Clear target
-                }
-            }
-        }
+        IssueGroupMove(worldX, worldY, true);
     }
 }
 
 void InputSystem::HandleAttackCommand(int mouseX, int mouseY) {
-    if (mSelectedEntities.empty()) {
+    if (mSelectedEntities.IsEmpty()) {
         return;
     }
     
@@ -405,6 +463,7 @@ void InputSystem::HandleAttackCommand(int mouseX, int mouseY) {
             if (auto* spacecraft = mRegistry.GetComponent<Spacecraft>(entity)) {
                 if (spacecraft->type == SpacecraftType::Player) {
                     spacecraft->targetEntity = target; // Set the target to pursue
+                    spacecraft->flowFieldId = FlowFieldSystem::INVALID_FIELD;
                     spacecraft->isMoving = true;
                     spacecraft->isAttacking = true;
                     SDL_Log("Unit %u ordered to attack and pursue enemy %u", entity, target);
@@ -413,154 +472,185 @@ void InputSystem::HandleAttackCommand(int mouseX, int mouseY) {
         }
     } else {
         // No enemy target, move to attack position
-        using namespace Components;
-        for (EntityID entity : mSelectedEntities) {
-            if (auto* spacecraft = mRegistry.GetComponent<Spacecraft>(entity)) {
-                if (spacecraft->type == SpacecraftType::Player) {
-                    spacecraft->destX = worldX;
-                    spacecraft->destY = worldY;
-                    spacecraft->isMoving = true;
-                    spacecraft->isAttacking = false;
-                }
-            }
-        }
+        IssueGroupMove(worldX, worldY, false);
         SDL_Log("Units ordered to move to attack position (%.2f, %.2f)", worldX, worldY);
     }
 }
 
-EntityID InputSystem::FindEntityAtPosition(float worldX, float worldY, float radius) const {
+void InputSystem::IssueGroupMove(float worldX, float worldY, bool clearTarget) {
     using namespace Components;
     
-    EntityID closestEntity = INVALID_ENTITY;
-    float closestDistance = std::numeric_limits<float>::max();
+    // Gather the player ships that will take part in the move
+    std::vector<Spacecraft*> ships;
+    std::vector<FormationPlanner::Point> shipPositions;
+    ships.reserve(mSelectedEntities.Size());
+    shipPositions.reserve(mSelectedEntities.Size());
     
-    mRegistry.ForEach<Position>([&](EntityID entity, const Position& pos) {
-        float dx = pos.posX - worldX;
-        float dy = pos.posY - worldY;
-        float distance = std::sqrt(dx * dx + dy * dy);
-        
-        if (distance <= radius && distance < closestDistance) {
-            closestDistance = distance;
-            closestEntity = entity;
+    for (EntityID entity : mSelectedEntities) {
+        auto* spacecraft = mRegistry.GetComponent<Spacecraft>(entity);
+        auto* position = mRegistry.GetComponent<Position>(entity);
+        if (spacecraft && position && spacecraft->type == SpacecraftType::Player) {
+            ships.push_back(spacecraft);
+            shipPositions.push_back({position->posX, position->posY});
         }
-    });
+    }
     
-    return closestEntity;
+    if (ships.empty()) {
+        return;
+    }
+    
+    // Every ship gets its own slot so the group settles without crowding the click point
+    auto slots = FormationPlanner::ComputeSlots(ships.size(), worldX, worldY, FORMATION_SPACING);
+    auto assignment = FormationPlanner::AssignSlots(shipPositions, slots);
+    
+    // One flow field leads the whole group to the formation; inside it ships steer to their slots
+    float formationRadius = FormationPlanner::FormationRadius(ships.size(), FORMATION_SPACING);
+    std::uint32_t flowFieldId = (mFlowFieldSystem != nullptr)
+        ? mFlowFieldSystem->RequestField(worldX, worldY, formationRadius + FORMATION_SPACING)
+        : FlowFieldSystem::INVALID_FIELD;
+    
+    for (std::size_t i = 0; i < ships.size(); ++i) {
+        Spacecraft* spacecraft = ships[i];
+        const auto& slot = slots[assignment[i]];
+        spacecraft->destX = slot.posX;
+        spacecraft->destY = slot.posY;
+        spacecraft->flowFieldId = flowFieldId;
+        spacecraft->isMoving = true;
+        spacecraft->isAttacking = false; // Clear attack mode
+        if (clearTarget) {
+            spacecraft->targetEntity = INVALID_ENTITY; // Clear target
+        }
+    }
 }
 
-EntityID InputSystem::FindSelectableEntityAtPosition(float worldX, float worldY, float radius) const {
-    using namespace Components;
+EntityID InputSystem::FindEntityAtPosition(float worldX, float worldY, float radius) const {
+    std::vector<EntityID> candidates;
+    GatherShips(worldX - radius, worldY - radius, worldX + radius, worldY + radius, candidates);
+    GatherPlanets(worldX - radius, worldY - radius, worldX + radius, worldY + radius, candidates);
     
-    EntityID closestEntity = INVALID_ENTITY;
-    float closestDistance = std::numeric_limits<float>::max();
+    return FindClosest(candidates, worldX, worldY, radius, [](EntityID) { return true; });
+}
+
+EntityID InputSystem::FindSelectableEntityAtPosition(float worldX, float worldY, float radius) const {
+    std::vector<EntityID> candidates;
+    GatherShips(worldX - radius, worldY - radius, worldX + radius, worldY + radius, candidates);
     
     // Only find player spacecraft that are alive
-    mRegistry.ForEach<Position>([&](EntityID entity, const Position& pos) {
-        auto* spacecraft = mRegistry.GetComponent<Spacecraft>(entity);
-        auto* health = mRegistry.GetComponent<Health>(entity);
-        if (!spacecraft || spacecraft->type != SpacecraftType::Player || 
-            !health || !health->isAlive) {
-            return; // Skip non-player entities or dead entities
-        }
-        
-        float deltaX = pos.posX - worldX;
-        float deltaY = pos.posY - worldY;
-        float distance = std::sqrt((deltaX * deltaX) + (deltaY * deltaY));
-        
-        if (distance <= radius && distance < closestDistance) {
-            closestDistance = distance;
-            closestEntity = entity;
-        }
+    return FindClosest(candidates, worldX, worldY, radius, [this](EntityID entity) {
+        return IsLivingShip(entity, Components::SpacecraftType::Player);
     });
-    
-    return closestEntity;
 }
 
 EntityID InputSystem::FindEnemyAtPosition(float worldX, float worldY, float radius) const {
+    std::vector<EntityID> candidates;
+    GatherShips(worldX - radius, worldY - radius, worldX + radius, worldY + radius, candidates);
+    
+    // Only find enemy spacecraft that are alive
+    return FindClosest(candidates, worldX, worldY, radius, [this](EntityID entity) {
+        return IsLivingShip(entity, Components::SpacecraftType::Enemy);
+    });
+}
+
+EntityID InputSystem::FindSelectablePlanetAtPosition(float worldX, float worldY, float radius) const {
     using namespace Components;
     
-    EntityID closestEntity = INVALID_ENTITY;
-    float closestDistance = std::numeric_limits<float>::max();
+    std::vector<EntityID> candidates;
+    GatherPlanets(worldX - radius, worldY - radius, worldX + radius, worldY + radius, candidates);
     
-    // Only find enemy spacecraft that are alive
-    mRegistry.ForEach<Position>([&](EntityID entity, const Position& pos) {
-        auto* spacecraft = mRegistry.GetComponent<Spacecraft>(entity);
-        auto* health = mRegistry.GetComponent<Health>(entity);
-        if (!spacecraft || spacecraft->type != SpacecraftType::Enemy || 
-            !health || !health->isAlive) {
-            return; // Skip non-enemy entities or dead enemies
-        }
-        
-        float deltaX = pos.posX - worldX;
-        float deltaY = pos.posY - worldY;
-        float distance = std::sqrt((deltaX * deltaX) + (deltaY * deltaY));
-        
-        if (distance <= radius && distance < closestDistance) {
-            closestDistance = distance;
-            closestEntity = entity;
+    // Only find planets that are player-owned
+    return FindClosest(candidates, worldX, worldY, radius, [this](EntityID entity) {
+        auto* planet = mRegistry.GetComponent<Planet>(entity);
+        return planet != nullptr && planet->isPlayerOwned;
+    });
+}
+
+void InputSystem::GatherShips(float minX, float minY, float maxX, float maxY, std::vector<EntityID>& results) const {
+    using namespace Components;
+    
+    // The index was rebuilt after the last update, so it matches what is on screen
+    if (mSpatialIndex != nullptr) {
+        mSpatialIndex->QueryShips(minX, minY, maxX, maxY, results);
+        return;
+    }
+    
+    // No index attached; test every ship against the rectangle instead
+    mRegistry.ForEach<Spacecraft>([&](EntityID entity, const Spacecraft& spacecraft) {
+        (void)spacecraft;
+        auto* position = mRegistry.GetComponent<Position>(entity);
+        if (position && position->posX >= minX && position->posX <= maxX &&
+            position->posY >= minY && position->posY <= maxY) {
+            results.push_back(entity);
         }
     });
+}
+
+void InputSystem::GatherPlanets(float minX, float minY, float maxX, float maxY, std::vector<EntityID>& results) const {
+    using namespace Components;
     
-    return closestEntity;
+    if (mSpatialIndex != nullptr) {
+        mSpatialIndex->QueryPlanets(minX, minY, maxX, maxY, results);
+        return;
+    }
+    
+    mRegistry.ForEach<Planet>([&](EntityID entity, const Planet& planet) {
+        (void)planet;
+        auto* position = mRegistry.GetComponent<Position>(entity);
+        if (position && position->posX >= minX && position->posX <= maxX &&
+            position->posY >= minY && position->posY <= maxY) {
+            results.push_back(entity);
+        }
+    });
 }
 
-EntityID InputSystem::FindSelectablePlanetAtPosition(float worldX, float worldY, float radius) const {
+EntityID InputSystem::FindClosest(const std::vector<EntityID>& candidates, float worldX, float worldY, float radius,
+                                  const std::function<bool(EntityID)>& filter) const {
     using namespace Components;
     
     EntityID closestEntity = INVALID_ENTITY;
     float closestDistance = std::numeric_limits<float>::max();
     
-    // Only find planets that are player-owned
-    mRegistry.ForEach<Position>([&](EntityID entity, const Position& pos) {
-        auto* planet = mRegistry.GetComponent<Planet>(entity);
-        if (!planet || !planet->isPlayerOwned) {
-            return; // Skip non-planets or enemy planets
+    for (EntityID entity : candidates) {
+        auto* position = mRegistry.GetComponent<Position>(entity);
+        if (position == nullptr || !filter(entity)) {
+            continue;
         }
         
-        float deltaX = pos.posX - worldX;
-        float deltaY = pos.posY - worldY;
+        float deltaX = position->posX - worldX;
+        float deltaY = position->posY - worldY;
         float distance = std::sqrt((deltaX * deltaX) + (deltaY * deltaY));
         
         if (distance <= radius && distance < closestDistance) {
             closestDistance = distance;
             closestEntity = entity;
         }
-    });
+    }
     
     return closestEntity;
 }
 
-std::vector<EntityID> InputSystem::FindEntitiesInBox(float minX, float minY, float maxX, float maxY) const {
+bool InputSystem::IsLivingShip(EntityID entity, Components::SpacecraftType type) const {
     using namespace Components;
     
+    auto* spacecraft = mRegistry.GetComponent<Spacecraft>(entity);
+    auto* health = mRegistry.GetComponent<Health>(entity);
+    return spacecraft != nullptr && spacecraft->type == type && health != nullptr && health->isAlive;
+}
+
+std::vector<EntityID> InputSystem::FindEntitiesInBox(float minX, float minY, float maxX, float maxY) const {
     std::vector<EntityID> entities;
-    
-    mRegistry.ForEach<Position>([&](EntityID entity, const Position& pos) {
-        if (pos.posX >= minX && pos.posX <= maxX && pos.posY >= minY && pos.posY <= maxY) {
-            entities.push_back(entity);
-        }
-    });
-    
+    GatherShips(minX, minY, maxX, maxY, entities);
+    GatherPlanets(minX, minY, maxX, maxY, entities);
     return entities;
 }
 
 std::vector<EntityID> InputSystem::FindSelectableEntitiesInBox(float minX, float minY, float maxX, float maxY) const {
-    using namespace Components;
-    
     std::vector<EntityID> entities;
+    GatherShips(minX, minY, maxX, maxY, entities);
     
-    mRegistry.ForEach<Position>([&](EntityID entity, const Position& pos) {
-        if (pos.posX >= minX && pos.posX <= maxX && pos.posY >= minY && pos.posY <= maxY) {
-            // Only include player spacecraft that are alive
-            auto* spacecraft = mRegistry.GetComponent<Spacecraft>(entity);
-            auto* health = mRegistry.GetComponent<Health>(entity);
-            if (spacecraft && spacecraft->type == SpacecraftType::Player && 
-                health && health->isAlive) {
-                entities.push_back(entity);
-            }
-        }
-    });
-    
+    // Only include player spacecraft that are alive
+    entities.erase(std::remove_if(entities.begin(), entities.end(), [this](EntityID entity) {
+        return !IsLivingShip(entity, Components::SpacecraftType::Player);
+    }), entities.end());
     return entities;
 }
 
@@ -593,30 +683,69 @@ void InputSystem::SetPlanetSelected(EntityID planet, bool selected) {
     }
 }
 
+void InputSystem::ClearShipSelection() {
+    // Only the selected units carry a highlight, so there is no need to visit the rest of the world
+    for (EntityID entity : mSelectedEntities) {
+        SetEntitySelected(entity, false);
+    }
+    mSelectedEntities.Clear();
+}
+
 void InputSystem::ClearAllSelections() {
-    using namespace Components;
+    ClearShipSelection();
     
-    // Clear all entity selections
-    mRegistry.ForEach<Selectable>([&](EntityID entity, Selectable& selectable) {
-        (void)entity; // Suppress unused parameter warning
-        selectable.isSelected = false;
-    });
+    // The selected planet keeps its build panel, only its highlight is cleared
+    if (mSelectedPlanet != INVALID_ENTITY) {
+        SetEntitySelected(mSelectedPlanet, false);
+    }
+}
+
+void InputSystem::OnEntityDied(const GameEvent& event) {
+    // Remove the dead unit from the selection and clear its visual highlight
+    if (!mSelectedEntities.Remove(event.entity)) {
+        return;
+    }
+    
+    SetEntitySelected(event.entity, false);
+    
+    if (mUISystem != nullptr) {
+        mUISystem->UpdateSelectedCount(static_cast<int>(mSelectedEntities.Size()));
+    }
 }
 
-void InputSystem::CleanupDeadEntitiesFromSelection() {
+void InputSystem::AssignControlGroup(int group) {
+    auto& members = mControlGroups[static_cast<std::size_t>(group - 1)];
+    members.assign(mSelectedEntities.begin(), mSelectedEntities.end());
+    
+    SDL_Log("Control group %d set to %zu units", group, members.size());
+}
+
+void InputSystem::RecallControlGroup(int group) {
     using namespace Components;
     
-    // Remove dead entities from selection and clear their visual highlight
-    auto iterator = std::remove_if(mSelectedEntities.begin(), mSelectedEntities.end(), 
-        [this](EntityID entity) {
-            auto* health = mRegistry.GetComponent<Health>(entity);
-            if (!health || !health->isAlive) {
-                // Clear the visual selection highlight for dead entities
-                SetEntitySelected(entity, false);
-                return true;
-            }
-            return false;
-        });
+    // Entity IDs are never reused, so a dead member can only fail the check, never alias a new ship
+    auto& members = mControlGroups[static_cast<std::size_t>(group - 1)];
+    members.erase(std::remove_if(members.begin(), members.end(), [this](EntityID entity) {
+        return !IsLivingShip(entity, SpacecraftType::Player);
+    }), members.end());
+    
+    if (members.empty()) {
+        return;
+    }
+    
+    // Same as clicking a ship: the planet selection goes away
+    SetPlanetSelected(mSelectedPlanet, false);
+    mSelectedPlanet = INVALID_ENTITY;
+    ClearAllSelections();
     
-    mSelectedEntities.erase(iterator, mSelectedEntities.end());
+    for (EntityID entity : members) {
+        mSelectedEntities.Add(entity);
+        SetEntitySelected(entity, true);
+    }
+    
+    SDL_Log("Recalled control group %d (%zu units)", group, members.size());
+    
+    if (mUISystem != nullptr) {
+        mUISystem->UpdateSelectedCount(static_cast<int>(mSelectedEntities.Size()));
+    }
 }
@@ -1,8 +1,11 @@
 #pragma once
 
+#include "../components/Components.h"
 #include "../core/ECSRegistry.h"
 #include "../core/SystemBase.h"
+#include "SelectionSet.h"
 #include <SDL2/SDL.h>
+#include <array>
 #include <vector>
 #include <functional>
 
@@ -11,6 +14,10 @@ class GameStateManager;
 class Renderer;
 class UISystem;
 class GameplaySystem;
+class FlowFieldSystem;
+class SpatialIndexSystem;
+class EventBus;
+struct GameEvent;
 
 /**
  * @brief Professional input system
@@ -32,6 +39,15 @@ public:
     // Set gameplay system for game state resets
     void SetGameplaySystem(GameplaySystem* gameplaySystem) { mGameplaySystem = gameplaySystem; }
 
+    // Set flow field system for group move orders
+    void SetFlowFieldSystem(FlowFieldSystem* flowFieldSystem) { mFlowFieldSystem = flowFieldSystem; }
+
+    // Set spatial index so picking only looks at entities near the cursor
+    void SetSpatialIndex(SpatialIndexSystem* spatialIndex) { mSpatialIndex = spatialIndex; }
+
+    // Subscribe to death events to drop dead units from the selection
+    void SetEventBus(EventBus* eventBus);
+
     // SystemBase interface
     bool Initialize() override;
     void Update(float deltaTime) override;
@@ -53,6 +69,7 @@ private:
     void HandleMouseButtonDown(const SDL_MouseButtonEvent& event);
     void HandleMouseButtonUp(const SDL_MouseButtonEvent& event);
     void HandleMouseMotion(const SDL_MouseMotionEvent& event);
+    void HandleMouseWheel(const SDL_MouseWheelEvent& event);
     void HandleKeyDown(const SDL_KeyboardEvent& event);
     void HandleKeyUp(const SDL_KeyboardEvent& event);
 
@@ -61,6 +78,7 @@ private:
     void HandleBoxSelection(int startX, int startY, int endX, int endY);
     void HandleMovement(int mouseX, int mouseY);
     void HandleAttackCommand(int mouseX, int mouseY);
+    void IssueGroupMove(float worldX, float worldY, bool clearTarget);
 
     // Utility functions
     EntityID FindEntityAtPosition(float worldX, float worldY, float radius) const;
@@ -68,13 +86,23 @@ private:
     EntityID FindSelectablePlanetAtPosition(float worldX, float worldY, float radius) const;
     EntityID FindEnemyAtPosition(float worldX, float worldY, float radius) const;
     std::vector<EntityID> FindEntitiesInBox(float minX, float minY, float maxX, float maxY) const;
+    void GatherShips(float minX, float minY, float maxX, float maxY, std::vector<EntityID>& results) const;
+    void GatherPlanets(float minX, float minY, float maxX, float maxY, std::vector<EntityID>& results) const;
+    EntityID FindClosest(const std::vector<EntityID>& candidates, float worldX, float worldY, float radius,
+                         const std::function<bool(EntityID)>& filter) const;
+    bool IsLivingShip(EntityID entity, Components::SpacecraftType type) const;
     std::vector<EntityID> FindSelectableEntitiesInBox(float minX, float minY, float maxX, float maxY) const;
 
     // Selection management
     void SetEntitySelected(EntityID entity, bool selected);
     void SetPlanetSelected(EntityID planet, bool selected);
+    void ClearShipSelection();
     void ClearAllSelections();
-    void CleanupDeadEntitiesFromSelection();
+    void OnEntityDied(const GameEvent& event);
+
+    // Control groups, numbered 1 to CONTROL_GROUP_COUNT
+    void AssignControlGroup(int group);
+    void RecallControlGroup(int group);
 
     // Input state
     std::vector<bool> mKeyStates;
@@ -83,7 +111,7 @@ private:
     int mMouseY;
 
     // Selection state
-    std::vector<EntityID> mSelectedEntities;
+    SelectionSet mSelectedEntities;
     bool mIsDragging;
     int mDragStartX;
     int mDragStartY;
@@ -93,6 +121,10 @@ private:
     // UI state
     EntityID mSelectedPlanet;
 
+    // Saved selections; dead members are only dropped when their group is recalled
+    static constexpr int CONTROL_GROUP_COUNT = 9;
+    std::array<std::vector<EntityID>, CONTROL_GROUP_COUNT> mControlGroups;
+
     // Game state integration
     GameStateManager* mGameStateManager;
 
@@ -105,11 +137,20 @@ private:
     // Gameplay system integration
     GameplaySystem* mGameplaySystem = nullptr;
 
+    // Pathing integration
+    FlowFieldSystem* mFlowFieldSystem = nullptr;
+
+    // Picking integration; without it picking scans every entity
+    SpatialIndexSystem* mSpatialIndex = nullptr;
+
     // Constants
     static constexpr float SHIP_CLICK_RADIUS = 0.06F; // Increased for easier targeting
     static constexpr float ENEMY_CLICK_RADIUS = 0.12F; // Increased for easier targeting
     static constexpr float PLANET_CLICK_RADIUS = 0.18F; // Slightly increased
     static constexpr int MIN_DRAG_DISTANCE = 5;
+    static constexpr float CAMERA_PAN_SPEED = 1.5F; // World units per second at zoom 1
+    static constexpr float CAMERA_ZOOM_STEP = 1.15F; // Zoom factor per wheel notch
+    static constexpr float FORMATION_SPACING = 0.07F; // Wider than the separation radius so settled ships stay apart
     static constexpr float WORLD_X_SCALE = 2.0F;
     static constexpr float WORLD_X_OFFSET = 1.0F;
     static constexpr float WORLD_Y_SCALE = 2.0F;
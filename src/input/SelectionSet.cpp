@@ -0,0 +1,31 @@
+#include "SelectionSet.h"
+
+bool SelectionSet::Add(EntityID entity) {
+    auto [iterator, inserted] = mSlots.try_emplace(entity, static_cast<std::uint32_t>(mEntities.size()));
+    (void)iterator;
+    if (inserted) {
+        mEntities.push_back(entity);
+    }
+    return inserted;
+}
+
+bool SelectionSet::Remove(EntityID entity) {
+    auto iterator = mSlots.find(entity);
+    if (iterator == mSlots.end()) {
+        return false;
+    }
+
+    // Move the last member into the freed slot
+    std::uint32_t slot = iterator->second;
+    EntityID last = mEntities.back();
+    mEntities[slot] = last;
+    mSlots[last] = slot;
+    mEntities.pop_back();
+    mSlots.erase(iterator);
+    return true;
+}
+
+void SelectionSet::Clear() {
+    mEntities.clear();
+    mSlots.clear();
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "../core/ECSRegistry.h"
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Set of entities with constant-time add, remove and membership tests
+ *
+ * Members are packed into a dense array, which is what iteration walks, and
+ * an index map gives each member's slot. Removal swaps the last member into
+ * the freed slot, so iteration order is not insertion order. Clearing costs
+ * the size of the set, not of the world.
+ */
+class SelectionSet {
+public:
+    /**
+     * @brief Insert entity
+     * @return false if it was already a member
+     */
+    bool Add(EntityID entity);
+
+    /**
+     * @brief Erase entity
+     * @return false if it was not a member
+     */
+    bool Remove(EntityID entity);
+
+    bool Contains(EntityID entity) const { return mSlots.find(entity) != mSlots.end(); }
+
+    void Clear();
+
+    std::size_t Size() const { return mEntities.size(); }
+    bool IsEmpty() const { return mEntities.empty(); }
+
+    const std::vector<EntityID>& GetEntities() const { return mEntities; }
+    std::vector<EntityID>::const_iterator begin() const { return mEntities.begin(); }
+    std::vector<EntityID>::const_iterator end() const { return mEntities.end(); }
+
+private:
+    std::vector<EntityID> mEntities;                    // Dense members
+    std::unordered_map<EntityID, std::uint32_t> mSlots; // Entity -> index into mEntities
+};
@@ -1,5 +1,121 @@
 #include "core/Game.h"
+#include "rendering/OfflineAudio.h"
 #include <SDL_log.h>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+namespace {
+    /**
+     * @brief Audio tools that run instead of the game and need no devices
+     */
+    struct AudioToolOptions {
+        std::string renderPath;     // Mix the scripted event stream into this WAV file
+        std::uint32_t renderSeconds = 10;
+        bool benchmark = false;     // Time the audio callback at several voice counts
+
+        bool IsRequested() const { return !renderPath.empty() || benchmark; }
+    };
+
+    void PrintUsage(const char* program) {
+        SDL_Log("Usage: %s [options]", program);
+        SDL_Log("  --size WxH            Window or capture size in pixels (default 1600x1200)");
+        SDL_Log("  --frames N            Exit after N frames");
+        SDL_Log("  --seed N              Seed for spawn randomness (default 1)");
+        SDL_Log("  --headless            Render offscreen with a fixed timestep and record frame timings");
+        SDL_Log("  --snapshot-every N    With --headless, write frame_NNNNNN.ppm every N frames");
+        SDL_Log("  --output DIR          With --headless, directory for snapshots and frame_timings.csv");
+        SDL_Log("  --audio-render FILE   Mix a scripted stream of sounds into a WAV file and exit");
+        SDL_Log("  --audio-seconds N     With --audio-render, length of the render (default 10)");
+        SDL_Log("  --audio-benchmark     Time the audio callback at several voice counts and exit");
+    }
+
+    bool ParseUnsigned(const char* text, std::uint32_t& value) {
+        char* end = nullptr;
+        unsigned long parsed = std::strtoul(text, &end, 10);
+        if (end == text || *end != '\0') {
+            return false;
+        }
+        value = static_cast<std::uint32_t>(parsed);
+        return true;
+    }
+
+    /**
+     * @brief Fill options from argv; returns false on unknown or malformed arguments
+     */
+    bool ParseArguments(int argc, char* argv[], Core::GameOptions& options, AudioToolOptions& audioTools) {
+        for (int i = 1; i < argc; ++i) {
+            const char* argument = argv[i];
+            const char* value = (i + 1 < argc) ? argv[i + 1] : nullptr;
+            bool consumed = true;
+
+            if (std::strcmp(argument, "--headless") == 0) {
+                options.headless = true;
+                consumed = false;
+            } else if (std::strcmp(argument, "--frames") == 0) {
+                if (value == nullptr || !ParseUnsigned(value, options.frameLimit)) {
+                    return false;
+                }
+            } else if (std::strcmp(argument, "--seed") == 0) {
+                if (value == nullptr || !ParseUnsigned(value, options.seed)) {
+                    return false;
+                }
+            } else if (std::strcmp(argument, "--snapshot-every") == 0) {
+                if (value == nullptr || !ParseUnsigned(value, options.snapshotInterval)) {
+                    return false;
+                }
+            } else if (std::strcmp(argument, "--output") == 0) {
+                if (value == nullptr) {
+                    return false;
+                }
+                options.captureDirectory = value;
+            } else if (std::strcmp(argument, "--audio-render") == 0) {
+                if (value == nullptr) {
+                    return false;
+                }
+                audioTools.renderPath = value;
+            } else if (std::strcmp(argument, "--audio-seconds") == 0) {
+                if (value == nullptr || !ParseUnsigned(value, audioTools.renderSeconds) || audioTools.renderSeconds == 0) {
+                    return false;
+                }
+            } else if (std::strcmp(argument, "--audio-benchmark") == 0) {
+                audioTools.benchmark = true;
+                consumed = false;
+            } else if (std::strcmp(argument, "--size") == 0) {
+                if (value == nullptr || std::sscanf(value, "%dx%d", &options.windowWidth, &options.windowHeight) != 2 ||
+                    options.windowWidth <= 0 || options.windowHeight <= 0) {
+                    return false;
+                }
+            } else {
+                return false;
+            }
+
+            if (consumed) {
+                ++i;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Run the requested audio tools, each on a fresh mixer
+     */
+    bool RunAudioTools(const AudioToolOptions& audioTools) {
+        if (!audioTools.renderPath.empty()) {
+            OfflineAudio audio;
+            if (!audio.RenderToWav(audioTools.renderPath, audioTools.renderSeconds)) {
+                return false;
+            }
+        }
+        if (audioTools.benchmark) {
+            OfflineAudio audio;
+            audio.RunBenchmark();
+        }
+        return true;
+    }
+}
 
 /**
  * @brief Entry point for the Space RTS game
@@ -8,14 +124,29 @@
  * all game logic to the Game class using proper RAII principles.
  */
 int main(int argc, char* argv[]) {
-    (void)argc; // Suppress unused parameter warning
-    (void)argv; // Suppress unused parameter warning
-    
     SDL_Log("=== Space RTS - Professional Edition ===");
+    
+    Core::GameOptions options;
+    AudioToolOptions audioTools;
+    if (!ParseArguments(argc, argv, options, audioTools)) {
+        PrintUsage(argv[0]);
+        return -1;
+    }
+    
+    if (audioTools.IsRequested()) {
+        return RunAudioTools(audioTools) ? 0 : -1;
+    }
+    
+    // A headless run with no frame limit would never exit
+    if (options.headless && options.frameLimit == 0) {
+        constexpr std::uint32_t DEFAULT_HEADLESS_FRAMES = 600;
+        options.frameLimit = DEFAULT_HEADLESS_FRAMES;
+    }
+    
     SDL_Log("Initializing game engine...");
     
     // Create game instance
-    Core::Game game;
+    Core::Game game(options);
     
     // Initialize the game
     if (!game.Initialize()) {
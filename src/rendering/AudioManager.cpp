@@ -1,4 +1,7 @@
 #include "AudioManager.h"
+#include "../core/EventBus.h"
+#include "Camera.h"
+#include "SineTable.h"
 #include <SDL_log.h>
 #include <cmath>
 #include <algorithm>
@@ -7,14 +10,59 @@
 #define M_PI 3.14159265358979323846
 #endif
 
+namespace {
+    constexpr float FADE_SECONDS = 0.01F; // Attack and release ramps that prevent pops
+    constexpr float EFFECT_HEADROOM = 0.8F;
+    constexpr float SOFT_CLIP_KNEE = 0.8F;
+    
+    struct Partial {
+        float frequency;
+        float duration;
+        float amplitude;
+    };
+    
+    struct SoundDefinition {
+        std::uint8_t priority;     // Higher survives voice stealing
+        std::uint8_t maxInstances; // Concurrent voices of this sound
+        float pitchVariation;      // Random playback rate spread, as a fraction
+        float volumeVariation;     // Random volume spread, as a fraction
+        std::uint8_t partialCount;
+        std::array<Partial, 3> partials;
+    };
+    
+    // Indexed by AudioManager::SoundType
+    constexpr std::array<SoundDefinition, 3> SOUND_DEFINITIONS = {{
+        // Beep: high-pitched short UI feedback, never stolen by combat and never varied
+        {2, 2, 0.0F, 0.0F, 1, {{{800.0F, 0.1F, 0.4F}}}},
+        // Pew: lower laser sound, the most frequent and least important
+        {0, 12, 0.06F, 0.15F, 1, {{{220.0F, 0.15F, 0.3F}}}},
+        // Boom: low rumble, mid frequency and high crack at reduced amplitudes to prevent clipping
+        {1, 8, 0.1F, 0.1F, 3, {{{60.0F, 0.3F, 0.2F}, {120.0F, 0.2F, 0.15F}, {200.0F, 0.1F, 0.1F}}}}
+    }};
+    
+    constexpr int CACHE_RENDER_BLOCK = 32; // Envelope ramp granularity while pre-rendering
+}
+
 AudioManager::AudioManager()
     : mInitialized(false)
     , mAudioDevice(0)
+    , mAudioSpec()
     , mMusicPlaying(false)
     , mMusicVolume(0.5F)
-    , mMusicTime(0.0F)
-    , mCurrentNote(0)
+    , mCommands()
+    , mDroppedCommands(0)
+    , mSamples()
+    , mVoices()
+    , mNextStartOrder(0)
+    , mRandomState(0x9E3779B9U)
+    , mMixerMusicPlaying(false)
+    , mMixerMusicVolume(0.5F)
+    , mMusic(SAMPLE_RATE)
+    , mMixLeft()
+    , mMixRight()
 {
+    // Needs no audio device, so offline mixing works without one
+    RenderSoundCache();
 }
 
 AudioManager::~AudioManager() {
@@ -54,53 +102,68 @@ bool AudioManager::Initialize() {
     return true;
 }
 
-void AudioManager::Update(float deltaTime) {
-    if (!mInitialized) {
-        return;
-    }
-    
-    // Update music timing
-    if (mMusicPlaying) {
-        mMusicTime += deltaTime;
-    }
-    
-    // Clean up finished tones
-    mActiveTones.erase(
-        std::remove_if(mActiveTones.begin(), mActiveTones.end(),
-            [](const ToneData& tone) { return !tone.active; }),
-        mActiveTones.end());
+void AudioManager::Update(float /*deltaTime*/) {
+    // Voices and music are advanced sample by sample on the audio thread
 }
 
 void AudioManager::Shutdown() {
     if (mInitialized) {
-        SDL_CloseAudioDevice(mAudioDevice);
-        SDL_QuitSubSystem(SDL_INIT_AUDIO);
+        if (mDroppedCommands > 0) {
+            SDL_Log("Audio command queue overflowed, %u sounds dropped", mDroppedCommands);
+        }
+        if (mAudioDevice != 0) {
+            SDL_CloseAudioDevice(mAudioDevice);
+            SDL_QuitSubSystem(SDL_INIT_AUDIO);
+            mAudioDevice = 0;
+        }
         SDL_Log("Audio manager shutdown");
         mInitialized = false;
     }
 }
 
+bool AudioManager::InitializeOffline() {
+    if (mInitialized) {
+        SDL_Log("Audio manager already initialized, cannot switch to offline mixing");
+        return false;
+    }
+    
+    mInitialized = true;
+    SDL_Log("Audio manager initialized offline - Sample Rate: %d, Channels: %d", SAMPLE_RATE, CHANNELS);
+    return true;
+}
+
+void AudioManager::MixOffline(Sint16* buffer, int frames) {
+    GenerateAudio(buffer, frames * CHANNELS);
+}
+
+int AudioManager::GetActiveVoiceCount() const {
+    return static_cast<int>(std::count_if(mVoices.begin(), mVoices.end(), [](const Voice& voice) { return voice.active; }));
+}
+
+void AudioManager::SetEventBus(EventBus* eventBus) {
+    if (eventBus == nullptr) {
+        return;
+    }
+    
+    eventBus->Subscribe(GameEventType::EntityDied, [this](const GameEvent& event) { PlayBoom(event.posX, event.posY); });
+}
+
 void AudioManager::PlayBeep() {
-    PlayTone(800.0F, 0.1F, 0.4F); // High-pitched short beep
+    PlaySound(SoundType::Beep);
 }
 
-void AudioManager::PlayPew() {
-    PlayTone(220.0F, 0.15F, 0.3F); // Lower laser sound
+void AudioManager::PlayPew(float posX, float posY) {
+    PlayPositionalSound(SoundType::Pew, posX, posY);
 }
 
-void AudioManager::PlayBoom() {
-    // Create explosion sound with multiple frequency components
-    // Reduced amplitudes to prevent interference and clipping
-    PlayTone(60.0F, 0.3F, 0.2F);   // Low rumble - reduced amplitude
-    PlayTone(120.0F, 0.2F, 0.15F); // Mid frequency - reduced amplitude
-    PlayTone(200.0F, 0.1F, 0.1F);  // High frequency crack - reduced amplitude
+void AudioManager::PlayBoom(float posX, float posY) {
+    PlayPositionalSound(SoundType::Boom, posX, posY);
 }
 
 void AudioManager::PlayBackgroundMusic() {
     if (!mMusicPlaying) {
         mMusicPlaying = true;
-        mMusicTime = 0.0F;
-        mCurrentNote = 0;
+        PostCommand({AudioCommandType::StartMusic, SoundType::Count, 0.0F, 0.0F});
         SDL_Log("Background music started");
     }
 }
@@ -108,30 +171,182 @@ void AudioManager::PlayBackgroundMusic() {
 void AudioManager::StopBackgroundMusic() {
     if (mMusicPlaying) {
         mMusicPlaying = false;
+        PostCommand({AudioCommandType::StopMusic, SoundType::Count, 0.0F, 0.0F});
         SDL_Log("Background music stopped");
     }
 }
 
 void AudioManager::SetMusicVolume(float volume) {
     mMusicVolume = std::max(0.0F, std::min(1.0F, volume));
+    PostCommand({AudioCommandType::SetMusicVolume, SoundType::Count, mMusicVolume, 0.0F});
     SDL_Log("Music volume set to %.2f", mMusicVolume);
 }
 
-void AudioManager::PlayTone(float frequency, float duration, float amplitude) {
+void AudioManager::PlaySound(SoundType sound, float volume, float pan) {
     if (!mInitialized) {
         return;
     }
     
-    ToneData tone;
-    tone.frequency = frequency;
-    tone.duration = duration;
-    tone.amplitude = amplitude;
-    tone.phase = 0.0F;
-    tone.active = true;
+    PostCommand({AudioCommandType::PlaySound, sound, volume, pan});
+}
+
+void AudioManager::PlayPositionalSound(SoundType sound, float posX, float posY) {
+    if (mCamera == nullptr) {
+        PlaySound(sound);
+        return;
+    }
+    
+    // Distance from the view center in half-extents: inside the view is at most 1
+    float offsetX = (posX - mCamera->GetPosX()) / mCamera->GetHalfWidth();
+    float offsetY = (posY - mCamera->GetPosY()) / mCamera->GetHalfHeight();
+    float distance = std::max(std::abs(offsetX), std::abs(offsetY));
+    
+    // Full volume on screen, fading linearly to silence at the audible range
+    float volume = 1.0F;
+    if (distance > 1.0F) {
+        volume = 1.0F - ((distance - 1.0F) / (AUDIBLE_RANGE - 1.0F));
+    }
+    
+    // Inaudible sounds never reach the queue or the mixer
+    if (volume < MIN_AUDIBLE_GAIN) {
+        return;
+    }
+    
+    float pan = std::max(-1.0F, std::min(1.0F, offsetX)) * PAN_WIDTH;
+    PlaySound(sound, volume, pan);
+}
+
+void AudioManager::PostCommand(const AudioCommand& command) {
+    // Dropping a sound in a burst is preferable to stalling the game thread
+    if (!mCommands.TryPush(command)) {
+        ++mDroppedCommands;
+    }
+}
+
+void AudioManager::ProcessCommands() {
+    AudioCommand command;
+    while (mCommands.TryPop(command)) {
+        switch (command.type) {
+            case AudioCommandType::PlaySound:
+                StartVoice(command.sound, command.volume, command.pan);
+                break;
+            case AudioCommandType::StartMusic:
+                mMixerMusicPlaying = true;
+                mMusic.Restart();
+                break;
+            case AudioCommandType::StopMusic:
+                mMixerMusicPlaying = false;
+                break;
+            case AudioCommandType::SetMusicVolume:
+                mMixerMusicVolume = command.volume;
+                break;
+        }
+    }
+}
+
+void AudioManager::RenderSoundCache() {
+    static_assert(SOUND_DEFINITIONS.size() == static_cast<std::size_t>(SoundType::Count), "One definition per sound");
     
-    SDL_LockAudioDevice(mAudioDevice);
-    mActiveTones.push_back(tone);
-    SDL_UnlockAudioDevice(mAudioDevice);
+    for (std::size_t index = 0; index < SOUND_DEFINITIONS.size(); ++index) {
+        const SoundDefinition& definition = SOUND_DEFINITIONS[index];
+        SoundSample& sample = mSamples[index];
+        sample.partialCount = definition.partialCount;
+        
+        std::int32_t length = 0;
+        for (std::size_t i = 0; i < definition.partialCount; ++i) {
+            length = std::max(length, static_cast<std::int32_t>(definition.partials[i].duration * static_cast<float>(SAMPLE_RATE)));
+        }
+        sample.data.assign(static_cast<std::size_t>(length) + 1, 0.0F);
+        
+        // Same oscillators and envelopes as live synthesis, summed at unit gain
+        for (std::size_t i = 0; i < definition.partialCount; ++i) {
+            const Partial& partial = definition.partials[i];
+            ToneData tone = {
+                0.0F,
+                partial.frequency / static_cast<float>(SAMPLE_RATE),
+                partial.amplitude,
+                0,
+                static_cast<std::int32_t>(partial.duration * static_cast<float>(SAMPLE_RATE)),
+                true
+            };
+            while (tone.active) {
+                MixTone(tone, sample.data.data() + tone.elapsed, CACHE_RENDER_BLOCK, 1.0F);
+            }
+        }
+    }
+}
+
+float AudioManager::NextVariation() {
+    // xorshift32, mapped to [-1, 1]
+    mRandomState ^= mRandomState << 13;
+    mRandomState ^= mRandomState >> 17;
+    mRandomState ^= mRandomState << 5;
+    return (static_cast<float>(mRandomState >> 8) / static_cast<float>(1U << 23)) - 1.0F;
+}
+
+void AudioManager::StartVoice(SoundType sound, float volume, float pan) {
+    const SoundDefinition& definition = SOUND_DEFINITIONS[static_cast<std::size_t>(sound)];
+    Voice* voice = AllocateVoice(sound, definition.priority, definition.maxInstances);
+    if (voice == nullptr) {
+        return;
+    }
+    
+    voice->position = 0.0F;
+    voice->step = 1.0F + (definition.pitchVariation * NextVariation());
+    
+    // Equal-power pan keeps loudness constant across the stereo field
+    float variedVolume = volume * (1.0F + (definition.volumeVariation * NextVariation()));
+    float panAngle = (pan + 1.0F) * 0.25F * static_cast<float>(M_PI);
+    voice->leftGain = variedVolume * std::cos(panAngle);
+    voice->rightGain = variedVolume * std::sin(panAngle);
+    voice->sound = sound;
+    voice->priority = definition.priority;
+    voice->startOrder = mNextStartOrder++;
+    voice->active = true;
+}
+
+AudioManager::Voice* AudioManager::AllocateVoice(SoundType sound, std::uint8_t priority, std::uint8_t maxInstances) {
+    Voice* freeVoice = nullptr;
+    Voice* oldestInstance = nullptr;
+    Voice* stealCandidate = nullptr;
+    int instances = 0;
+    
+    for (auto& voice : mVoices) {
+        if (!voice.active) {
+            if (freeVoice == nullptr) {
+                freeVoice = &voice;
+            }
+            continue;
+        }
+        
+        // Order comparisons are wrap-safe for the unsigned start counter
+        if (voice.sound == sound) {
+            ++instances;
+            if (oldestInstance == nullptr ||
+                static_cast<std::int32_t>(voice.startOrder - oldestInstance->startOrder) < 0) {
+                oldestInstance = &voice;
+            }
+        }
+        if (stealCandidate == nullptr || voice.priority < stealCandidate->priority ||
+            (voice.priority == stealCandidate->priority &&
+             static_cast<std::int32_t>(voice.startOrder - stealCandidate->startOrder) < 0)) {
+            stealCandidate = &voice;
+        }
+    }
+    
+    // Past its limit a sound retriggers its own oldest instance rather than piling up
+    if (instances >= maxInstances) {
+        return oldestInstance;
+    }
+    if (freeVoice != nullptr) {
+        return freeVoice;
+    }
+    
+    // Pool is full: never steal from a more important sound
+    if (stealCandidate != nullptr && stealCandidate->priority <= priority) {
+        return stealCandidate;
+    }
+    return nullptr;
 }
 
 void AudioManager::AudioCallback(void* userdata, Uint8* stream, int len) {
@@ -143,142 +358,112 @@ void AudioManager::AudioCallback(void* userdata, Uint8* stream, int len) {
 }
 
 void AudioManager::GenerateAudio(Sint16* buffer, int samples) {
-    // Clear buffer
-    std::fill(buffer, buffer + samples, 0);
+    // Pick up sounds and music changes posted since the last buffer
+    ProcessCommands();
     
-    // Count active tones for amplitude normalization
+    int frames = samples / CHANNELS;
+    for (int offset = 0; offset < frames; offset += MIX_BLOCK_SIZE) {
+        int blockFrames = std::min(MIX_BLOCK_SIZE, frames - offset);
+        float* left = mMixLeft.data();
+        float* right = mMixRight.data();
+        std::fill(left, left + blockFrames, 0.0F);
+        std::fill(right, right + blockFrames, 0.0F);
+        
+        MixVoices(left, right, blockFrames);
+        if (mMixerMusicPlaying) {
+            mMusic.Render(left, right, blockFrames, mMixerMusicVolume);
+        }
+        
+        WriteOutput(left, right, buffer + (static_cast<std::ptrdiff_t>(offset) * CHANNELS), blockFrames);
+    }
+}
+
+void AudioManager::MixVoices(float* left, float* right, int frames) {
+    // Weight voices by partial count for amplitude normalization, as when partials were mixed live
     int activeToneCount = 0;
-    for (const auto& tone : mActiveTones) {
-        if (tone.active) activeToneCount++;
+    for (const auto& voice : mVoices) {
+        if (voice.active) {
+            activeToneCount += mSamples[static_cast<std::size_t>(voice.sound)].partialCount;
+        }
+    }
+    if (activeToneCount == 0) {
+        return;
     }
     
-    // Prevent division by zero and apply normalization for multiple tones
-    float normalizationFactor = (activeToneCount > 0) ? (1.0F / std::sqrt(static_cast<float>(activeToneCount))) : 1.0F;
-    
-    // Generate sound effects
-    for (auto& tone : mActiveTones) {
-        if (!tone.active) continue;
-        
-        for (int i = 0; i < samples; ++i) {
-            // Calculate fade envelope to prevent pops
-            float fadeTime = 0.01F; // 10ms fade in/out
-            float totalDuration = tone.duration + (2.0F * fadeTime);
-            float currentTime = totalDuration - tone.duration;
-            
-            float envelope = 1.0F;
-            if (currentTime < fadeTime) {
-                // Fade in
-                envelope = currentTime / fadeTime;
-            } else if (tone.duration < fadeTime) {
-                // Fade out
-                envelope = tone.duration / fadeTime;
-            }
-            
-            // Generate sine wave with envelope and normalization
-            float sampleValue = tone.amplitude * envelope * normalizationFactor * std::sin(tone.phase);
-            tone.phase += 2.0F * static_cast<float>(M_PI) * tone.frequency / static_cast<float>(SAMPLE_RATE);
-            
-            // Keep phase in range to prevent accumulation errors
-            if (tone.phase > 2.0F * static_cast<float>(M_PI)) {
-                tone.phase -= 2.0F * static_cast<float>(M_PI);
-            }
-            
-            // Convert to 16-bit integer and mix with safe addition
-            float currentSample = static_cast<float>(buffer[i]) / 32767.0F;
-            float newSample = currentSample + (sampleValue * 0.8F); // Leave headroom
-            buffer[i] = static_cast<Sint16>(std::max(-1.0F, std::min(1.0F, newSample)) * 32767.0F);
-            
-            // Update duration
-            tone.duration -= 1.0F / static_cast<float>(SAMPLE_RATE);
-            if (tone.duration <= 0.0F) {
-                tone.active = false;
-                break;
-            }
+    float gain = EFFECT_HEADROOM / std::sqrt(static_cast<float>(activeToneCount));
+    for (auto& voice : mVoices) {
+        if (voice.active) {
+            // The voice returns to the pool once its sample has played out
+            voice.active = MixSample(voice, mSamples[static_cast<std::size_t>(voice.sound)], left, right, frames, gain);
         }
     }
+}
+
+bool AudioManager::MixSample(Voice& voice, const SoundSample& sample, float* left, float* right, int frames, float gain) {
+    const float* data = sample.data.data();
+    const auto lastIndex = static_cast<float>(sample.data.size() - 1); // The trailing zero
+    const float leftLevel = voice.leftGain * gain;
+    const float rightLevel = voice.rightGain * gain;
+    const float step = voice.step;
+    float position = voice.position;
     
-    // Generate background music
-    if (mMusicPlaying) {
-        GenerateBackgroundMusic(buffer, samples);
+    for (int i = 0; i < frames && position < lastIndex; ++i) {
+        auto index = static_cast<std::size_t>(position);
+        float fraction = position - static_cast<float>(index);
+        float value = data[index] + (fraction * (data[index + 1] - data[index]));
+        left[i] += leftLevel * value;
+        right[i] += rightLevel * value;
+        position += step;
     }
     
-    // Apply master volume and clipping to prevent pops from overflow
-    for (int i = 0; i < samples; ++i) {
-        // Apply soft clipping to prevent harsh distortion
-        float sample = static_cast<float>(buffer[i]) / 32767.0F;
-        
-        // Soft clipping using tanh for smoother limiting
-        if (sample > 0.8F) {
-            sample = 0.8F + 0.2F * std::tanh((sample - 0.8F) * 5.0F);
-        } else if (sample < -0.8F) {
-            sample = -0.8F + 0.2F * std::tanh((sample + 0.8F) * 5.0F);
-        }
-        
-        // Convert back to 16-bit with proper clamping
-        int finalSample = static_cast<int>(sample * 32767.0F);
-        buffer[i] = static_cast<Sint16>(std::max(-32767, std::min(32767, finalSample)));
-    }
+    voice.position = position;
+    return position < lastIndex;
 }
 
-void AudioManager::GenerateBackgroundMusic(Sint16* buffer, int samples) {
-    // Techno-style ambient music - lower pitch, faster tempo, more electronic
-    // Using lower octave notes with added harmonics for tech feel
-    static const float bassNotes[] = {
-        65.41F, 73.42F, 82.41F, 98.00F, 110.00F,   // C2, D2, E2, G2, A2 - bass range
-        130.81F, 146.83F, 164.81F, 196.00F, 220.00F // C3, D3, E3, G3, A3 - low mid range
+void AudioManager::MixTone(ToneData& tone, float* bus, int samples, float gain) {
+    int count = std::min(samples, tone.length - tone.elapsed);
+    
+    // Linear attack/release envelope, evaluated at the block edges and ramped in between
+    auto envelope = [&tone](std::int32_t elapsed) {
+        float fadeSamples = FADE_SECONDS * static_cast<float>(SAMPLE_RATE);
+        float attack = static_cast<float>(elapsed) / fadeSamples;
+        float release = static_cast<float>(tone.length - elapsed) / fadeSamples;
+        return std::min(1.0F, std::min(attack, release));
     };
-    static const int numNotes = sizeof(bassNotes) / sizeof(bassNotes[0]);
-    static float musicPhase1 = 0.0F;
-    static float musicPhase2 = 0.0F;
-    static float musicPhase3 = 0.0F;
-    static int lastNoteIndex = 0;
-    static float noteTransition = 0.0F;
+    float level = tone.amplitude * gain * envelope(tone.elapsed);
+    float levelEnd = tone.amplitude * gain * envelope(tone.elapsed + count);
+    float levelStep = (count > 0) ? (levelEnd - level) / static_cast<float>(count) : 0.0F;
     
-    for (int i = 0; i < samples; ++i) {
-        // Change note every 0.8 seconds (faster tempo)
-        int noteIndex = static_cast<int>(mMusicTime * 1.25F) % numNotes;
-        
-        // Smooth note transitions to prevent pops
-        if (noteIndex != lastNoteIndex) {
-            noteTransition = 0.0F; // Reset transition
-            lastNoteIndex = noteIndex;
+    float phase = tone.phase;
+    const float phaseStep = tone.phaseStep;
+    for (int i = 0; i < count; ++i) {
+        bus[i] += level * SINE(phase);
+        level += levelStep;
+        phase = WrapPhase(phase + phaseStep);
+    }
+    
+    tone.phase = phase;
+    tone.elapsed += count;
+    tone.active = tone.elapsed < tone.length;
+}
+
+void AudioManager::WriteOutput(const float* left, const float* right, Sint16* buffer, int frames) {
+    static_assert(CHANNELS == 2, "Output is interleaved stereo");
+    
+    // Soft clipping using tanh above the knee for smoother limiting
+    auto softClip = [](float sample) {
+        if (sample > SOFT_CLIP_KNEE) {
+            return SOFT_CLIP_KNEE + (0.2F * std::tanh((sample - SOFT_CLIP_KNEE) * 5.0F));
         }
-        
-        // Smooth transition between notes over 50ms
-        const float transitionTime = 0.05F;
-        if (noteTransition < transitionTime) {
-            noteTransition += 1.0F / static_cast<float>(SAMPLE_RATE);
+        if (sample < -SOFT_CLIP_KNEE) {
+            return -SOFT_CLIP_KNEE + (0.2F * std::tanh((sample + SOFT_CLIP_KNEE) * 5.0F));
         }
-        float transitionSmooth = std::min(1.0F, noteTransition / transitionTime);
-        
-        float baseFreq = bassNotes[noteIndex];
-        
-        // Generate techno-style waveform with harmonics using continuous phase
-        float wave1 = std::sin(musicPhase1);
-        float wave2 = 0.3F * std::sin(musicPhase2);
-        float wave3 = 0.15F * std::sin(musicPhase3);
-        
-        // Update phases continuously to prevent discontinuities
-        musicPhase1 += 2.0F * static_cast<float>(M_PI) * baseFreq / static_cast<float>(SAMPLE_RATE);
-        musicPhase2 += 2.0F * static_cast<float>(M_PI) * baseFreq * 2.0F / static_cast<float>(SAMPLE_RATE);
-        musicPhase3 += 2.0F * static_cast<float>(M_PI) * baseFreq * 3.0F / static_cast<float>(SAMPLE_RATE);
-        
-        // Keep phases in range
-        if (musicPhase1 > 2.0F * static_cast<float>(M_PI)) musicPhase1 -= 2.0F * static_cast<float>(M_PI);
-        if (musicPhase2 > 2.0F * static_cast<float>(M_PI)) musicPhase2 -= 2.0F * static_cast<float>(M_PI);
-        if (musicPhase3 > 2.0F * static_cast<float>(M_PI)) musicPhase3 -= 2.0F * static_cast<float>(M_PI);
-        
-        // Create pulsing envelope for electronic feel
-        float pulseRate = 4.0F; // 4 pulses per second
-        float envelope = 0.3F + 0.7F * (0.5F + 0.5F * std::sin(mMusicTime * 2.0F * static_cast<float>(M_PI) * pulseRate));
-        
-        // Apply transition smoothing and mix harmonics
-        float sampleValue = mMusicVolume * 0.15F * envelope * transitionSmooth * (wave1 + wave2 + wave3);
-        
-        // Mix with existing audio with proper clamping
-        int mixedSample = buffer[i] + static_cast<int>(sampleValue * 32767.0F);
-        buffer[i] = static_cast<Sint16>(std::max(-32768, std::min(32767, mixedSample)));
-        
-        mMusicTime += 1.0F / static_cast<float>(SAMPLE_RATE);
+        return sample;
+    };
+    
+    for (int i = 0; i < frames; ++i) {
+        buffer[2 * i] = static_cast<Sint16>(softClip(left[i]) * 32767.0F);
+        buffer[(2 * i) + 1] = static_cast<Sint16>(softClip(right[i]) * 32767.0F);
     }
 }
+
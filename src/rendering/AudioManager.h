@@ -1,26 +1,83 @@
 #pragma once
 
 #include "../core/ECSRegistry.h"
+#include "../utils/SpscQueue.h"
+#include "MusicSequencer.h"
 #include <SDL2/SDL.h>
+#include <array>
+#include <cstdint>
 #include <vector>
 #include <memory>
 
+class Camera;
+class EventBus;
+
 /**
  * @brief Audio management system with procedural sound generation
+ *
+ * The game thread never touches mixer state. Play and music calls are
+ * posted as commands on a lock-free single-producer/single-consumer queue,
+ * and the audio callback drains it at the start of every buffer; the voice
+ * list and music state belong to the audio thread alone. All calls must
+ * come from the game thread.
+ *
+ * Sounds play on a fixed pool of voices, so mixing cost is bounded however
+ * many ships fire. Each sound has a concurrency limit, past which its
+ * oldest instance is retriggered, and a priority; when the pool is full a
+ * new sound steals the oldest voice of the lowest priority not above its own.
+ *
+ * Each effect is synthesized once, at construction, into a float sample
+ * buffer; a voice plays that buffer back with a small random pitch and
+ * volume variation, so mixing an effect costs an interpolated copy rather
+ * than oscillators. Mixing runs in fixed-size blocks on a stereo float bus
+ * that is soft-clipped and converted to 16-bit once at the end.
+ *
+ * Combat sounds are positional: they are panned by their horizontal offset
+ * from the camera and attenuated with distance beyond the view, and sounds
+ * too far away to hear are culled before they are queued.
  */
 class AudioManager {
 public:
     AudioManager();
     ~AudioManager();
 
+    // Output format of the device buffers, and of offline renders
+    static constexpr int SAMPLE_RATE = 44100;
+    static constexpr int CHANNELS = 2; // Interleaved left/right
+    static constexpr int SAMPLES = 512; // Frames per device callback
+    
     bool Initialize();
     void Update(float deltaTime);
     void Shutdown();
+    
+    /**
+     * @brief Accept sounds without opening an audio device
+     *
+     * The caller then plays the audio thread's part itself by calling
+     * MixOffline, so the mixer can be rendered and timed on machines
+     * without sound hardware.
+     */
+    bool InitializeOffline();
+    
+    /**
+     * @brief Run the mixer for one buffer, exactly as the device callback does
+     * @param buffer Interleaved stereo, frames * CHANNELS samples
+     */
+    void MixOffline(Sint16* buffer, int frames);
+    
+    // Voices currently playing; mixer state, so only meaningful between MixOffline calls
+    int GetActiveVoiceCount() const;
+
+    // Play explosions for deaths announced on the event bus
+    void SetEventBus(EventBus* eventBus);
 
-    // Audio events
+    // Set the view that positional sounds are heard from; without one they play centered
+    void SetCamera(const Camera* camera) { mCamera = camera; }
+
+    // Audio events; combat sounds take the world position they happen at
     void PlayBeep();
-    void PlayPew();
-    void PlayBoom();
+    void PlayPew(float posX, float posY);
+    void PlayBoom(float posX, float posY);
     
     // Background music
     void PlayBackgroundMusic();
@@ -28,41 +85,113 @@ public:
     void SetMusicVolume(float volume); // 0.0 to 1.0
 
 private:
+    // Sound effects, indexing the definition table in AudioManager.cpp
+    enum class SoundType : std::uint8_t {
+        Beep,
+        Pew,
+        Boom,
+        Count
+    };
+    
+    // One sine partial, synthesized while building the sample cache
+    struct ToneData {
+        float phase;          // In cycles, wrapped to [0, 1)
+        float phaseStep;      // Cycles per sample
+        float amplitude;
+        std::int32_t elapsed; // Samples played so far
+        std::int32_t length;  // Samples in total
+        bool active;
+    };
+    
+    // Pre-rendered effect, at unit gain with one trailing zero for interpolation
+    struct SoundSample {
+        std::vector<float> data;
+        std::uint8_t partialCount; // Weight in the mix normalization
+    };
+    
+    static constexpr std::size_t MAX_VOICES = 16;
+    
+    // A playing instance of a sound
+    struct Voice {
+        float position; // In source samples
+        float step;     // Source samples per output sample; sets the pitch
+        float leftGain;
+        float rightGain;
+        SoundType sound;
+        std::uint8_t priority;
+        std::uint32_t startOrder; // Larger is newer
+        bool active;
+    };
+    
+    // Request posted from the game thread to the audio thread
+    enum class AudioCommandType : std::uint8_t {
+        PlaySound,
+        StartMusic,
+        StopMusic,
+        SetMusicVolume
+    };
+    
+    struct AudioCommand {
+        AudioCommandType type;
+        SoundType sound; // PlaySound
+        float volume;    // PlaySound attenuation or music volume
+        float pan;       // PlaySound, -1 (left) to 1 (right)
+    };
+    
+    static constexpr std::size_t COMMAND_QUEUE_SIZE = 512; // Power of two
+    
     // Audio device management
     bool mInitialized;
     SDL_AudioDeviceID mAudioDevice;
     SDL_AudioSpec mAudioSpec;
     
-    // Music system
+    // Listener for positional sounds, read on the game thread only
+    const Camera* mCamera = nullptr;
+    
+    // Game thread view of the music state
     bool mMusicPlaying;
     float mMusicVolume;
-    float mMusicTime;
-    int mCurrentNote;
     
-    // Audio generation
-    struct ToneData {
-        float frequency;
-        float duration;
-        float amplitude;
-        float phase;
-        bool active;
-    };
+    // Game thread to audio thread commands; full-queue drops are counted, never waited on
+    SpscQueue<AudioCommand, COMMAND_QUEUE_SIZE> mCommands;
+    std::uint32_t mDroppedCommands;
+    
+    // Written once by the constructor, read-only afterwards
+    std::array<SoundSample, static_cast<std::size_t>(SoundType::Count)> mSamples;
     
-    std::vector<ToneData> mActiveTones;
+    // Owned by the audio thread
+    std::array<Voice, MAX_VOICES> mVoices;
+    std::uint32_t mNextStartOrder;
+    std::uint32_t mRandomState; // Own generator so audio never disturbs the seeded game rand()
+    bool mMixerMusicPlaying;
+    float mMixerMusicVolume;
+    MusicSequencer mMusic;
+    
+    // Float mix bus for one block of frames; a device buffer is mixed in as many blocks as it needs
+    static constexpr int MIX_BLOCK_SIZE = 256;
+    std::array<float, MIX_BLOCK_SIZE> mMixLeft;
+    std::array<float, MIX_BLOCK_SIZE> mMixRight;
     
     // Audio callback and generation functions
     static void AudioCallback(void* userdata, Uint8* stream, int len);
+    void PostCommand(const AudioCommand& command);
+    void ProcessCommands();
+    void RenderSoundCache();
+    void StartVoice(SoundType sound, float volume, float pan);
+    float NextVariation();
+    Voice* AllocateVoice(SoundType sound, std::uint8_t priority, std::uint8_t maxInstances);
     void GenerateAudio(Sint16* buffer, int samples);
-    void PlayTone(float frequency, float duration, float amplitude = 0.3f);
-    void GenerateBackgroundMusic(Sint16* buffer, int samples);
+    void PlaySound(SoundType sound, float volume = 1.0F, float pan = 0.0F);
+    void PlayPositionalSound(SoundType sound, float posX, float posY);
     
-    // Sound effect generators
-    void GenerateBeep(Sint16* buffer, int samples, float& phase);
-    void GeneratePew(Sint16* buffer, int samples, float& phase);
-    void GenerateBoom(Sint16* buffer, int samples, float& phase);
+    // Block mixing onto the float bus
+    void MixVoices(float* left, float* right, int frames);
+    static bool MixSample(Voice& voice, const SoundSample& sample, float* left, float* right, int frames, float gain);
+    static void MixTone(ToneData& tone, float* bus, int samples, float gain);
+    static void WriteOutput(const float* left, const float* right, Sint16* buffer, int frames);
     
-    // Music constants
-    static constexpr int SAMPLE_RATE = 44100;
-    static constexpr int CHANNELS = 1;
-    static constexpr int SAMPLES = 512;
+    // Positional sound falloff, in multiples of the view's half extent from its center
+    static constexpr float AUDIBLE_RANGE = 1.75F;  // Silent beyond this
+    static constexpr float MIN_AUDIBLE_GAIN = 0.05F; // Quieter sounds are culled
+    static constexpr float PAN_WIDTH = 0.8F;       // Keep edge sounds slightly in both ears
 };
@@ -0,0 +1,262 @@
+#include "BatchRenderer.h"
+#include "GeometryCache.h"
+#include <GL/gl.h>
+#include <SDL2/SDL.h>
+#include <SDL_log.h>
+#include <cstddef>
+#include <cstdio>
+
+#ifndef GL_ARRAY_BUFFER
+#define GL_ARRAY_BUFFER 0x8892
+#endif
+#ifndef GL_STREAM_DRAW
+#define GL_STREAM_DRAW 0x88E0
+#endif
+
+namespace {
+    // Buffer object entry points, resolved at runtime since <GL/gl.h> only covers GL 1.1
+    using GenBuffersProc = void (APIENTRY*)(GLsizei, GLuint*);
+    using DeleteBuffersProc = void (APIENTRY*)(GLsizei, const GLuint*);
+    using BindBufferProc = void (APIENTRY*)(GLenum, GLuint);
+    using BufferDataProc = void (APIENTRY*)(GLenum, std::ptrdiff_t, const void*, GLenum);
+
+    GenBuffersProc glGenBuffersFn = nullptr;
+    DeleteBuffersProc glDeleteBuffersFn = nullptr;
+    BindBufferProc glBindBufferFn = nullptr;
+    BufferDataProc glBufferDataFn = nullptr;
+
+    template<typename T>
+    T LoadProc(const char* coreName, const char* arbName) {
+        void* proc = SDL_GL_GetProcAddress(coreName);
+        if (proc == nullptr) {
+            proc = SDL_GL_GetProcAddress(arbName);
+        }
+        return reinterpret_cast<T>(proc);
+    }
+
+    bool HasBufferObjects() {
+        const auto* version = reinterpret_cast<const char*>(glGetString(GL_VERSION));
+        int major = 0;
+        int minor = 0;
+        if (version != nullptr && std::sscanf(version, "%d.%d", &major, &minor) == 2) {
+            if (major > 1 || (major == 1 && minor >= 5)) {
+                return true;
+            }
+        }
+        return SDL_GL_ExtensionSupported("GL_ARB_vertex_buffer_object") == SDL_TRUE;
+    }
+}
+
+BatchColor BatchColor::FromFloat(float red, float green, float blue, float alpha) {
+    auto toByte = [](float value) {
+        value = value < 0.0F ? 0.0F : (value > 1.0F ? 1.0F : value);
+        return static_cast<std::uint8_t>((value * 255.0F) + 0.5F);
+    };
+    return {toByte(red), toByte(green), toByte(blue), toByte(alpha)};
+}
+
+BatchRenderer::BatchRenderer()
+    : mTriangles()
+    , mLines()
+    , mLineRuns()
+    , mPixelsPerUnit(0.0F)
+    , mUseBuffers(false)
+    , mTriangleBuffer(0)
+    , mLineBuffer(0)
+{
+}
+
+BatchRenderer::~BatchRenderer() {
+    Shutdown();
+}
+
+bool BatchRenderer::Initialize() {
+    if (HasBufferObjects()) {
+        glGenBuffersFn = LoadProc<GenBuffersProc>("glGenBuffers", "glGenBuffersARB");
+        glDeleteBuffersFn = LoadProc<DeleteBuffersProc>("glDeleteBuffers", "glDeleteBuffersARB");
+        glBindBufferFn = LoadProc<BindBufferProc>("glBindBuffer", "glBindBufferARB");
+        glBufferDataFn = LoadProc<BufferDataProc>("glBufferData", "glBufferDataARB");
+        mUseBuffers = glGenBuffersFn && glDeleteBuffersFn && glBindBufferFn && glBufferDataFn;
+    }
+
+    if (mUseBuffers) {
+        glGenBuffersFn(1, &mTriangleBuffer);
+        glGenBuffersFn(1, &mLineBuffer);
+    }
+
+    SDL_Log("Batch renderer initialized (%s)", mUseBuffers ? "vertex buffer objects" : "client vertex arrays");
+    return true;
+}
+
+void BatchRenderer::Shutdown() {
+    if (mUseBuffers) {
+        glDeleteBuffersFn(1, &mTriangleBuffer);
+        glDeleteBuffersFn(1, &mLineBuffer);
+        mTriangleBuffer = 0;
+        mLineBuffer = 0;
+        mUseBuffers = false;
+    }
+}
+
+void BatchRenderer::Begin() {
+    mTriangles.clear();
+    mLines.clear();
+    mLineRuns.clear();
+}
+
+void BatchRenderer::Flush() {
+    // Vertex alpha is honored, e.g. for shaded density cells
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_COLOR_ARRAY);
+
+    if (!mTriangles.empty()) {
+        Submit(mTriangles, mTriangleBuffer);
+        DrawArrays(GL_TRIANGLES, 0, mTriangles.size());
+    }
+
+    if (!mLines.empty()) {
+        Submit(mLines, mLineBuffer);
+        for (const auto& run : mLineRuns) {
+            glLineWidth(run.width);
+            DrawArrays(GL_LINES, run.first, run.count);
+        }
+    }
+
+    if (mUseBuffers) {
+        glBindBufferFn(GL_ARRAY_BUFFER, 0);
+    }
+    glDisableClientState(GL_COLOR_ARRAY);
+    glDisableClientState(GL_VERTEX_ARRAY);
+    glDisable(GL_BLEND);
+
+    Begin();
+}
+
+void BatchRenderer::Submit(const std::vector<Vertex>& vertices, unsigned int buffer) {
+    const void* positions = &vertices.front().posX;
+    const void* colors = &vertices.front().color;
+    if (mUseBuffers) {
+        // Orphan and refill the buffer every frame; pointers become offsets into it
+        glBindBufferFn(GL_ARRAY_BUFFER, buffer);
+        glBufferDataFn(GL_ARRAY_BUFFER, static_cast<std::ptrdiff_t>(vertices.size() * sizeof(Vertex)),
+                       vertices.data(), GL_STREAM_DRAW);
+        positions = reinterpret_cast<const void*>(offsetof(Vertex, posX));
+        colors = reinterpret_cast<const void*>(offsetof(Vertex, color));
+    }
+
+    glVertexPointer(2, GL_FLOAT, sizeof(Vertex), positions);
+    glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), colors);
+}
+
+void BatchRenderer::DrawArrays(unsigned int mode, std::size_t first, std::size_t count) {
+    glDrawArrays(mode, static_cast<GLint>(first), static_cast<GLsizei>(count));
+}
+
+void BatchRenderer::AddTriangle(float x0, float y0, float x1, float y1, float x2, float y2, BatchColor color) {
+    mTriangles.push_back({x0, y0, color});
+    mTriangles.push_back({x1, y1, color});
+    mTriangles.push_back({x2, y2, color});
+}
+
+void BatchRenderer::AddQuad(float minX, float minY, float maxX, float maxY, BatchColor color) {
+    AddTriangle(minX, minY, maxX, minY, maxX, maxY, color);
+    AddTriangle(minX, minY, maxX, maxY, minX, maxY, color);
+}
+
+void BatchRenderer::AddCircle(float centerX, float centerY, float radius, BatchColor color) {
+    const auto& circle = GeometryCache::Get().GetCircle(radius * mPixelsPerUnit);
+    const float* cosTable = circle.cosTable.data();
+    const float* sinTable = circle.sinTable.data();
+
+    for (int i = 0; i < circle.segments; ++i) {
+        AddTriangle(
+            centerX, centerY,
+            centerX + (radius * cosTable[i]), centerY + (radius * sinTable[i]),
+            centerX + (radius * cosTable[i + 1]), centerY + (radius * sinTable[i + 1]),
+            color
+        );
+    }
+}
+
+void BatchRenderer::AddShip(float posX, float posY, float angle, float size, BatchColor color) {
+    float sinAngle = 0.0F;
+    float cosAngle = 0.0F;
+    GeometryCache::Get().SinCosDegrees(angle, sinAngle, cosAngle);
+
+    // Rotate and scale the shared ship mesh
+    const auto& mesh = GeometryCache::SHIP_MESH;
+    auto rotateX = [&](float localX, float localY) { return posX + (size * ((localX * cosAngle) - (localY * sinAngle))); };
+    auto rotateY = [&](float localX, float localY) { return posY + (size * ((localX * sinAngle) + (localY * cosAngle))); };
+    AddTriangle(
+        rotateX(mesh[0], mesh[1]), rotateY(mesh[0], mesh[1]),
+        rotateX(mesh[2], mesh[3]), rotateY(mesh[2], mesh[3]),
+        rotateX(mesh[4], mesh[5]), rotateY(mesh[4], mesh[5]),
+        color
+    );
+}
+
+void BatchRenderer::AddHealthBar(float posX, float posY, float width, float height, float healthPercent) {
+    static const BatchColor BACKGROUND = BatchColor::FromFloat(0.3F, 0.3F, 0.3F);
+    static const BatchColor FOREGROUND = BatchColor::FromFloat(0.2F, 1.0F, 0.2F);
+
+    AddQuad(posX, posY, posX + width, posY + height, BACKGROUND);
+    AddQuad(posX, posY, posX + (width * healthPercent), posY + height, FOREGROUND);
+}
+
+void BatchRenderer::Append(const BatchRenderer& other) {
+    mTriangles.insert(mTriangles.end(), other.mTriangles.begin(), other.mTriangles.end());
+
+    // Line runs are rebased onto this batch, merging across the seam when widths match
+    std::size_t lineOffset = mLines.size();
+    mLines.insert(mLines.end(), other.mLines.begin(), other.mLines.end());
+    for (const auto& run : other.mLineRuns) {
+        if (!mLineRuns.empty() && mLineRuns.back().width == run.width &&
+            mLineRuns.back().first + mLineRuns.back().count == lineOffset + run.first) {
+            mLineRuns.back().count += run.count;
+        } else {
+            mLineRuns.push_back({run.width, lineOffset + run.first, run.count});
+        }
+    }
+}
+
+void BatchRenderer::BeginLineRun(float lineWidth) {
+    if (mLineRuns.empty() || mLineRuns.back().width != lineWidth) {
+        mLineRuns.push_back({lineWidth, mLines.size(), 0});
+    }
+}
+
+void BatchRenderer::AddLine(float x0, float y0, float x1, float y1, float lineWidth, BatchColor color) {
+    BeginLineRun(lineWidth);
+    mLines.push_back({x0, y0, color});
+    mLines.push_back({x1, y1, color});
+    mLineRuns.back().count += 2;
+}
+
+void BatchRenderer::AddRectOutline(float minX, float minY, float maxX, float maxY, float lineWidth, BatchColor color) {
+    AddLine(minX, minY, maxX, minY, lineWidth, color);
+    AddLine(maxX, minY, maxX, maxY, lineWidth, color);
+    AddLine(maxX, maxY, minX, maxY, lineWidth, color);
+    AddLine(minX, maxY, minX, minY, lineWidth, color);
+}
+
+void BatchRenderer::AddTriangleOutline(float x0, float y0, float x1, float y1, float x2, float y2, float lineWidth, BatchColor color) {
+    AddLine(x0, y0, x1, y1, lineWidth, color);
+    AddLine(x1, y1, x2, y2, lineWidth, color);
+    AddLine(x2, y2, x0, y0, lineWidth, color);
+}
+
+void BatchRenderer::AddCircleOutline(float centerX, float centerY, float radius, float lineWidth, BatchColor color) {
+    BeginLineRun(lineWidth);
+
+    const auto& circle = GeometryCache::Get().GetCircle(radius * mPixelsPerUnit);
+    const float* cosTable = circle.cosTable.data();
+    const float* sinTable = circle.sinTable.data();
+
+    for (int i = 0; i < circle.segments; ++i) {
+        mLines.push_back({centerX + (radius * cosTable[i]), centerY + (radius * sinTable[i]), color});
+        mLines.push_back({centerX + (radius * cosTable[i + 1]), centerY + (radius * sinTable[i + 1]), color});
+    }
+    mLineRuns.back().count += 2 * static_cast<std::size_t>(circle.segments);
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Packed RGBA color used by batched vertices
+ */
+struct BatchColor {
+    std::uint8_t red = 255;
+    std::uint8_t green = 255;
+    std::uint8_t blue = 255;
+    std::uint8_t alpha = 255;
+
+    static BatchColor FromFloat(float red, float green, float blue, float alpha = 1.0F);
+};
+
+/**
+ * @brief Collects world geometry for a frame and draws it in a few calls
+ *
+ * Shapes are appended to CPU-side vertex arrays as they are visited and
+ * submitted on Flush with one glDrawArrays for all filled triangles and one
+ * per line width for outlines. Vertex data is streamed through a VBO when the
+ * driver exposes buffer objects (GL 1.5 or ARB_vertex_buffer_object) and
+ * through client-side vertex arrays otherwise, which every software GL supports.
+ */
+class BatchRenderer {
+public:
+    BatchRenderer();
+    ~BatchRenderer();
+
+    // Non-copyable, owns GL buffers
+    BatchRenderer(const BatchRenderer&) = delete;
+    BatchRenderer& operator=(const BatchRenderer&) = delete;
+
+    /**
+     * @brief Resolve buffer object entry points; requires a current GL context
+     * @return true (falls back to client arrays if VBOs are unavailable)
+     */
+    bool Initialize();
+    void Shutdown();
+
+    /**
+     * @brief Discard geometry from the previous frame
+     */
+    void Begin();
+
+    /**
+     * @brief Submit all queued geometry and clear the batches
+     */
+    void Flush();
+
+    /**
+     * @brief Append another batch's queued geometry, e.g. a retained UI panel
+     *
+     * The source only records vertices, so it need not be initialized.
+     */
+    void Append(const BatchRenderer& other);
+
+    bool IsEmpty() const { return mTriangles.empty() && mLines.empty(); }
+
+    // Filled primitives
+    void AddTriangle(float x0, float y0, float x1, float y1, float x2, float y2, BatchColor color);
+    void AddQuad(float minX, float minY, float maxX, float maxY, BatchColor color);
+    void AddCircle(float centerX, float centerY, float radius, BatchColor color);
+
+    /**
+     * @brief Ship triangle rotated by angle (degrees) around its center
+     */
+    void AddShip(float posX, float posY, float angle, float size, BatchColor color);
+
+    /**
+     * @brief Gray background and green fill bar
+     */
+    void AddHealthBar(float posX, float posY, float width, float height, float healthPercent);
+
+    // Outlines
+    void AddCircleOutline(float centerX, float centerY, float radius, float lineWidth, BatchColor color);
+    void AddLine(float x0, float y0, float x1, float y1, float lineWidth, BatchColor color);
+    void AddRectOutline(float minX, float minY, float maxX, float maxY, float lineWidth, BatchColor color);
+    void AddTriangleOutline(float x0, float y0, float x1, float y1, float x2, float y2, float lineWidth, BatchColor color);
+
+    /**
+     * @brief Set the current world-to-screen scale used to pick circle detail
+     */
+    void SetPixelsPerUnit(float pixelsPerUnit) { mPixelsPerUnit = pixelsPerUnit; }
+
+    bool IsUsingBuffers() const { return mUseBuffers; }
+
+private:
+    struct Vertex {
+        float posX;
+        float posY;
+        BatchColor color;
+    };
+
+    // A run of line vertices sharing one glLineWidth
+    struct LineRun {
+        float width;
+        std::size_t first;
+        std::size_t count;
+    };
+
+    void BeginLineRun(float lineWidth);
+    void Submit(const std::vector<Vertex>& vertices, unsigned int buffer);
+    void DrawArrays(unsigned int mode, std::size_t first, std::size_t count);
+
+    std::vector<Vertex> mTriangles;
+    std::vector<Vertex> mLines;
+    std::vector<LineRun> mLineRuns;
+
+    // Screen scale for circle level of detail
+    float mPixelsPerUnit;
+
+    // Buffer object support
+    bool mUseBuffers;
+    unsigned int mTriangleBuffer;
+    unsigned int mLineBuffer;
+};
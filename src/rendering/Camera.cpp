@@ -0,0 +1,67 @@
+#include "Camera.h"
+#include <algorithm>
+
+Camera::Camera()
+    : mPosX(0.0F)
+    , mPosY(0.0F)
+    , mZoom(1.0F)
+    , mViewportWidth(1)
+    , mViewportHeight(1)
+{
+}
+
+void Camera::SetViewport(int width, int height) {
+    mViewportWidth = std::max(width, 1);
+    mViewportHeight = std::max(height, 1);
+}
+
+void Camera::SetPosition(float posX, float posY) {
+    mPosX = posX;
+    mPosY = posY;
+    ClampPosition();
+}
+
+void Camera::Pan(float deltaX, float deltaY) {
+    SetPosition(mPosX + deltaX, mPosY + deltaY);
+}
+
+void Camera::SetZoom(float zoom) {
+    mZoom = std::clamp(zoom, MIN_ZOOM, MAX_ZOOM);
+}
+
+void Camera::ZoomAt(int screenX, int screenY, float factor) {
+    auto [anchorX, anchorY] = ScreenToWorld(screenX, screenY);
+    SetZoom(mZoom * factor);
+
+    // Shift the center so the anchor lands back under the same pixel
+    auto [movedX, movedY] = ScreenToWorld(screenX, screenY);
+    Pan(anchorX - movedX, anchorY - movedY);
+}
+
+void Camera::Reset() {
+    mPosX = 0.0F;
+    mPosY = 0.0F;
+    mZoom = 1.0F;
+}
+
+float Camera::GetPixelsPerUnit() const {
+    return static_cast<float>(mViewportWidth) / (2.0F * GetHalfWidth());
+}
+
+std::pair<float, float> Camera::ScreenToWorld(int screenX, int screenY) const {
+    float normalizedX = static_cast<float>(screenX) / static_cast<float>(mViewportWidth);
+    float normalizedY = static_cast<float>(screenY) / static_cast<float>(mViewportHeight);
+    float worldX = GetMinX() + (normalizedX * 2.0F * GetHalfWidth());
+    float worldY = GetMaxY() - (normalizedY * 2.0F * GetHalfHeight());
+    return {worldX, worldY};
+}
+
+bool Camera::IsVisible(float posX, float posY, float radius) const {
+    return posX + radius >= GetMinX() && posX - radius <= GetMaxX() &&
+           posY + radius >= GetMinY() && posY - radius <= GetMaxY();
+}
+
+void Camera::ClampPosition() {
+    mPosX = std::clamp(mPosX, -PAN_LIMIT_X, PAN_LIMIT_X);
+    mPosY = std::clamp(mPosY, -PAN_LIMIT_Y, PAN_LIMIT_Y);
+}
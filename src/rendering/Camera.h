@@ -0,0 +1,75 @@
+#pragma once
+
+#include <utility>
+
+/**
+ * @brief 2D view into the world with pan and zoom
+ *
+ * At zoom 1 centered on the origin the view matches the original fixed
+ * projection: two world units across and 1.5 units tall. Zooming scales the
+ * visible extent around the camera center; the center is clamped so the view
+ * cannot drift arbitrarily far from the playable area.
+ */
+class Camera {
+public:
+    Camera();
+
+    // Viewport in window pixels, used for screen <-> world conversion
+    void SetViewport(int width, int height);
+
+    // Position of the view center in world units
+    void SetPosition(float posX, float posY);
+    void Pan(float deltaX, float deltaY);
+    float GetPosX() const { return mPosX; }
+    float GetPosY() const { return mPosY; }
+
+    void SetZoom(float zoom);
+    float GetZoom() const { return mZoom; }
+
+    /**
+     * @brief Multiply zoom by factor while keeping the world point under the cursor fixed
+     */
+    void ZoomAt(int screenX, int screenY, float factor);
+
+    /**
+     * @brief Back to the default view of the original play area
+     */
+    void Reset();
+
+    // Visible extent around the center
+    float GetHalfWidth() const { return BASE_HALF_WIDTH / mZoom; }
+    float GetHalfHeight() const { return BASE_HALF_HEIGHT / mZoom; }
+    float GetMinX() const { return mPosX - GetHalfWidth(); }
+    float GetMaxX() const { return mPosX + GetHalfWidth(); }
+    float GetMinY() const { return mPosY - GetHalfHeight(); }
+    float GetMaxY() const { return mPosY + GetHalfHeight(); }
+
+    /**
+     * @brief Window pixels per world unit at the current zoom
+     */
+    float GetPixelsPerUnit() const;
+
+    std::pair<float, float> ScreenToWorld(int screenX, int screenY) const;
+
+    /**
+     * @brief Whether a circle overlaps the visible area
+     */
+    bool IsVisible(float posX, float posY, float radius) const;
+
+    static constexpr float MIN_ZOOM = 0.25F;
+    static constexpr float MAX_ZOOM = 4.0F;
+    static constexpr float PAN_LIMIT_X = 3.0F;
+    static constexpr float PAN_LIMIT_Y = 2.25F;
+
+private:
+    void ClampPosition();
+
+    float mPosX;
+    float mPosY;
+    float mZoom;
+    int mViewportWidth;
+    int mViewportHeight;
+
+    static constexpr float BASE_HALF_WIDTH = 1.0F;
+    static constexpr float BASE_HALF_HEIGHT = 0.75F;
+};
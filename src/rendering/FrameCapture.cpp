@@ -0,0 +1,205 @@
+#include "FrameCapture.h"
+#include <GL/gl.h>
+#include <SDL2/SDL.h>
+#include <SDL_log.h>
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <numeric>
+
+#ifndef GL_FRAMEBUFFER
+#define GL_FRAMEBUFFER 0x8D40
+#endif
+#ifndef GL_RENDERBUFFER
+#define GL_RENDERBUFFER 0x8D41
+#endif
+#ifndef GL_COLOR_ATTACHMENT0
+#define GL_COLOR_ATTACHMENT0 0x8CE0
+#endif
+#ifndef GL_FRAMEBUFFER_COMPLETE
+#define GL_FRAMEBUFFER_COMPLETE 0x8CD5
+#endif
+
+namespace {
+    // Framebuffer object entry points, resolved at runtime since <GL/gl.h> only covers GL 1.1
+    using GenFramebuffersProc = void (APIENTRY*)(GLsizei, GLuint*);
+    using DeleteFramebuffersProc = void (APIENTRY*)(GLsizei, const GLuint*);
+    using BindFramebufferProc = void (APIENTRY*)(GLenum, GLuint);
+    using GenRenderbuffersProc = void (APIENTRY*)(GLsizei, GLuint*);
+    using DeleteRenderbuffersProc = void (APIENTRY*)(GLsizei, const GLuint*);
+    using BindRenderbufferProc = void (APIENTRY*)(GLenum, GLuint);
+    using RenderbufferStorageProc = void (APIENTRY*)(GLenum, GLenum, GLsizei, GLsizei);
+    using FramebufferRenderbufferProc = void (APIENTRY*)(GLenum, GLenum, GLenum, GLuint);
+    using CheckFramebufferStatusProc = GLenum (APIENTRY*)(GLenum);
+
+    GenFramebuffersProc glGenFramebuffersFn = nullptr;
+    DeleteFramebuffersProc glDeleteFramebuffersFn = nullptr;
+    BindFramebufferProc glBindFramebufferFn = nullptr;
+    GenRenderbuffersProc glGenRenderbuffersFn = nullptr;
+    DeleteRenderbuffersProc glDeleteRenderbuffersFn = nullptr;
+    BindRenderbufferProc glBindRenderbufferFn = nullptr;
+    RenderbufferStorageProc glRenderbufferStorageFn = nullptr;
+    FramebufferRenderbufferProc glFramebufferRenderbufferFn = nullptr;
+    CheckFramebufferStatusProc glCheckFramebufferStatusFn = nullptr;
+
+    template<typename T>
+    T LoadProc(const char* coreName, const char* extName) {
+        void* proc = SDL_GL_GetProcAddress(coreName);
+        if (proc == nullptr) {
+            proc = SDL_GL_GetProcAddress(extName);
+        }
+        return reinterpret_cast<T>(proc);
+    }
+
+    double Percentile(std::vector<double> values, double fraction) {
+        if (values.empty()) {
+            return 0.0;
+        }
+        auto index = static_cast<std::size_t>(fraction * static_cast<double>(values.size() - 1));
+        std::nth_element(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(index), values.end());
+        return values[index];
+    }
+}
+
+FrameCapture::FrameCapture()
+    : mWidth(0)
+    , mHeight(0)
+    , mOutputDirectory()
+    , mFramebuffer(0)
+    , mColorBuffer(0)
+    , mTimings()
+    , mPixels()
+{
+}
+
+FrameCapture::~FrameCapture() {
+    Shutdown();
+}
+
+bool FrameCapture::Initialize(int width, int height, const std::string& outputDirectory) {
+    mWidth = width;
+    mHeight = height;
+    mOutputDirectory = outputDirectory;
+
+    // Fail early rather than after a long run
+    std::ofstream probe(mOutputDirectory + "/frame_timings.csv");
+    if (!probe) {
+        SDL_Log("Cannot write to capture directory '%s'", mOutputDirectory.c_str());
+        return false;
+    }
+
+    if (!CreateFramebuffer()) {
+        SDL_Log("Framebuffer objects unavailable, capturing from the window back buffer");
+    }
+
+    SDL_Log("Frame capture initialized (%dx%d, %s) -> %s", mWidth, mHeight,
+            IsUsingFramebuffer() ? "framebuffer object" : "back buffer", mOutputDirectory.c_str());
+    return true;
+}
+
+void FrameCapture::Shutdown() {
+    if (!mTimings.empty()) {
+        WriteTimings();
+        mTimings.clear();
+    }
+
+    if (mFramebuffer != 0) {
+        glBindFramebufferFn(GL_FRAMEBUFFER, 0);
+        glDeleteFramebuffersFn(1, &mFramebuffer);
+        glDeleteRenderbuffersFn(1, &mColorBuffer);
+        mFramebuffer = 0;
+        mColorBuffer = 0;
+    }
+}
+
+void FrameCapture::BindTarget() {
+    if (mFramebuffer != 0) {
+        glBindFramebufferFn(GL_FRAMEBUFFER, mFramebuffer);
+    }
+}
+
+void FrameCapture::RecordTiming(std::uint32_t frameIndex, double updateMs, double renderMs) {
+    mTimings.push_back({frameIndex, updateMs, renderMs});
+}
+
+bool FrameCapture::WriteSnapshot(std::uint32_t frameIndex) {
+    auto rowBytes = static_cast<std::size_t>(mWidth) * 3;
+    mPixels.resize(rowBytes * static_cast<std::size_t>(mHeight));
+
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    if (mFramebuffer == 0) {
+        glReadBuffer(GL_BACK);
+    }
+    glReadPixels(0, 0, mWidth, mHeight, GL_RGB, GL_UNSIGNED_BYTE, mPixels.data());
+
+    char fileName[32];
+    std::snprintf(fileName, sizeof(fileName), "/frame_%06u.ppm", frameIndex);
+    std::ofstream file(mOutputDirectory + fileName, std::ios::binary);
+    if (!file) {
+        SDL_Log("Failed to write snapshot for frame %u", frameIndex);
+        return false;
+    }
+
+    // GL rows start at the bottom, PPM rows at the top
+    file << "P6\n" << mWidth << ' ' << mHeight << "\n255\n";
+    for (int row = mHeight - 1; row >= 0; --row) {
+        file.write(reinterpret_cast<const char*>(mPixels.data() + (static_cast<std::size_t>(row) * rowBytes)),
+                   static_cast<std::streamsize>(rowBytes));
+    }
+    return true;
+}
+
+bool FrameCapture::CreateFramebuffer() {
+    glGenFramebuffersFn = LoadProc<GenFramebuffersProc>("glGenFramebuffers", "glGenFramebuffersEXT");
+    glDeleteFramebuffersFn = LoadProc<DeleteFramebuffersProc>("glDeleteFramebuffers", "glDeleteFramebuffersEXT");
+    glBindFramebufferFn = LoadProc<BindFramebufferProc>("glBindFramebuffer", "glBindFramebufferEXT");
+    glGenRenderbuffersFn = LoadProc<GenRenderbuffersProc>("glGenRenderbuffers", "glGenRenderbuffersEXT");
+    glDeleteRenderbuffersFn = LoadProc<DeleteRenderbuffersProc>("glDeleteRenderbuffers", "glDeleteRenderbuffersEXT");
+    glBindRenderbufferFn = LoadProc<BindRenderbufferProc>("glBindRenderbuffer", "glBindRenderbufferEXT");
+    glRenderbufferStorageFn = LoadProc<RenderbufferStorageProc>("glRenderbufferStorage", "glRenderbufferStorageEXT");
+    glFramebufferRenderbufferFn = LoadProc<FramebufferRenderbufferProc>("glFramebufferRenderbuffer", "glFramebufferRenderbufferEXT");
+    glCheckFramebufferStatusFn = LoadProc<CheckFramebufferStatusProc>("glCheckFramebufferStatus", "glCheckFramebufferStatusEXT");
+
+    bool hasEntryPoints = glGenFramebuffersFn && glDeleteFramebuffersFn && glBindFramebufferFn &&
+                          glGenRenderbuffersFn && glDeleteRenderbuffersFn && glBindRenderbufferFn &&
+                          glRenderbufferStorageFn && glFramebufferRenderbufferFn && glCheckFramebufferStatusFn;
+    if (!hasEntryPoints) {
+        return false;
+    }
+
+    glGenRenderbuffersFn(1, &mColorBuffer);
+    glBindRenderbufferFn(GL_RENDERBUFFER, mColorBuffer);
+    glRenderbufferStorageFn(GL_RENDERBUFFER, GL_RGBA8, mWidth, mHeight);
+    glBindRenderbufferFn(GL_RENDERBUFFER, 0);
+
+    glGenFramebuffersFn(1, &mFramebuffer);
+    glBindFramebufferFn(GL_FRAMEBUFFER, mFramebuffer);
+    glFramebufferRenderbufferFn(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, mColorBuffer);
+    GLenum status = glCheckFramebufferStatusFn(GL_FRAMEBUFFER);
+    glBindFramebufferFn(GL_FRAMEBUFFER, 0);
+
+    if (status != GL_FRAMEBUFFER_COMPLETE) {
+        glDeleteFramebuffersFn(1, &mFramebuffer);
+        glDeleteRenderbuffersFn(1, &mColorBuffer);
+        mFramebuffer = 0;
+        mColorBuffer = 0;
+        return false;
+    }
+    return true;
+}
+
+void FrameCapture::WriteTimings() const {
+    std::ofstream file(mOutputDirectory + "/frame_timings.csv");
+    file << "frame,update_ms,render_ms\n";
+    std::vector<double> renderTimes;
+    renderTimes.reserve(mTimings.size());
+    for (const auto& timing : mTimings) {
+        file << timing.frameIndex << ',' << timing.updateMs << ',' << timing.renderMs << '\n';
+        renderTimes.push_back(timing.renderMs);
+    }
+
+    double mean = std::accumulate(renderTimes.begin(), renderTimes.end(), 0.0) / static_cast<double>(renderTimes.size());
+    SDL_Log("Render time over %zu frames: mean %.3f ms, p50 %.3f ms, p95 %.3f ms, max %.3f ms",
+            renderTimes.size(), mean, Percentile(renderTimes, 0.5), Percentile(renderTimes, 0.95),
+            *std::max_element(renderTimes.begin(), renderTimes.end()));
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Offscreen render target with image snapshots and frame timings
+ *
+ * Used for headless runs on machines without a display GPU. Frames are drawn
+ * into a framebuffer object when the driver provides one (GL 3.0,
+ * ARB_framebuffer_object or EXT_framebuffer_object, all of which Mesa's
+ * software rasterizers expose) and into the hidden window's back buffer
+ * otherwise. Snapshots are written as binary PPM so they can be diffed
+ * without an image library, and per-frame timings are written as CSV.
+ */
+class FrameCapture {
+public:
+    FrameCapture();
+    ~FrameCapture();
+
+    // Non-copyable, owns GL objects
+    FrameCapture(const FrameCapture&) = delete;
+    FrameCapture& operator=(const FrameCapture&) = delete;
+
+    /**
+     * @brief Create the render target; requires a current GL context
+     * @param outputDirectory Existing directory for snapshots and timings
+     * @return false if the output directory is not writable
+     */
+    bool Initialize(int width, int height, const std::string& outputDirectory);
+
+    /**
+     * @brief Write timings and release the render target
+     */
+    void Shutdown();
+
+    /**
+     * @brief Direct rendering into the capture target
+     */
+    void BindTarget();
+
+    /**
+     * @brief Record how long the simulation and the (finished) render of one frame took
+     */
+    void RecordTiming(std::uint32_t frameIndex, double updateMs, double renderMs);
+
+    /**
+     * @brief Read back the current frame and write it as frame_NNNNNN.ppm
+     */
+    bool WriteSnapshot(std::uint32_t frameIndex);
+
+    bool IsUsingFramebuffer() const { return mFramebuffer != 0; }
+
+private:
+    struct FrameTiming {
+        std::uint32_t frameIndex;
+        double updateMs;
+        double renderMs;
+    };
+
+    bool CreateFramebuffer();
+    void WriteTimings() const;
+
+    int mWidth;
+    int mHeight;
+    std::string mOutputDirectory;
+
+    unsigned int mFramebuffer;
+    unsigned int mColorBuffer;
+
+    std::vector<FrameTiming> mTimings;
+    std::vector<std::uint8_t> mPixels; // Readback scratch, reused across snapshots
+};
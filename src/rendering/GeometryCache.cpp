@@ -0,0 +1,59 @@
+#include "GeometryCache.h"
+#include <cmath>
+
+namespace {
+    constexpr float TWO_PI = 2.0F * 3.14159265F;
+}
+
+const GeometryCache& GeometryCache::Get() {
+    static const GeometryCache instance;
+    return instance;
+}
+
+GeometryCache::GeometryCache()
+    : mCircles()
+    , mSinTable(ANGLE_TABLE_SIZE)
+    , mCosTable(ANGLE_TABLE_SIZE)
+{
+    for (int lod = 0; lod < LOD_COUNT; ++lod) {
+        CircleTable& circle = mCircles[lod];
+        circle.segments = LOD_SEGMENTS[lod];
+        circle.cosTable.resize(circle.segments + 1);
+        circle.sinTable.resize(circle.segments + 1);
+
+        for (int i = 0; i <= circle.segments; ++i) {
+            float theta = TWO_PI * static_cast<float>(i) / static_cast<float>(circle.segments);
+            circle.cosTable[i] = std::cos(theta);
+            circle.sinTable[i] = std::sin(theta);
+        }
+
+        // Close the loop exactly so adjacent fans share their seam vertex
+        circle.cosTable[circle.segments] = circle.cosTable[0];
+        circle.sinTable[circle.segments] = circle.sinTable[0];
+    }
+
+    for (int i = 0; i < ANGLE_TABLE_SIZE; ++i) {
+        float theta = TWO_PI * static_cast<float>(i) / static_cast<float>(ANGLE_TABLE_SIZE);
+        mSinTable[i] = std::sin(theta);
+        mCosTable[i] = std::cos(theta);
+    }
+}
+
+const GeometryCache::CircleTable& GeometryCache::GetCircle(float pixelRadius) const {
+    float circumference = TWO_PI * pixelRadius;
+    for (const auto& circle : mCircles) {
+        if (static_cast<float>(circle.segments) * TARGET_EDGE_PIXELS >= circumference) {
+            return circle;
+        }
+    }
+    return mCircles.back();
+}
+
+void GeometryCache::SinCosDegrees(float degrees, float& sinOut, float& cosOut) const {
+    constexpr float DEGREES_TO_INDEX = static_cast<float>(ANGLE_TABLE_SIZE) / 360.0F;
+
+    // Round to the nearest entry; the table size is a power of two so masking wraps negatives too
+    int index = static_cast<int>(std::lround(degrees * DEGREES_TO_INDEX)) & (ANGLE_TABLE_SIZE - 1);
+    sinOut = mSinTable[index];
+    cosOut = mCosTable[index];
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <array>
+#include <vector>
+
+/**
+ * @brief Precomputed geometry shared by all renderer draw paths
+ *
+ * Holds unit-circle vertex tables at several levels of detail and a sine /
+ * cosine lookup table for rotating ship triangles, all generated once at
+ * startup so that no trig is evaluated per frame.
+ */
+class GeometryCache {
+public:
+    /**
+     * @brief Unit circle sampled at a fixed number of segments
+     *
+     * Holds segments + 1 points so the last point closes the loop.
+     */
+    struct CircleTable {
+        int segments = 0;
+        std::vector<float> cosTable;
+        std::vector<float> sinTable;
+    };
+
+    /**
+     * @brief Shared instance, built on first use
+     */
+    static const GeometryCache& Get();
+
+    /**
+     * @brief Pick the circle table whose edge length suits an on-screen radius
+     * @param pixelRadius Circle radius in screen pixels
+     */
+    const CircleTable& GetCircle(float pixelRadius) const;
+
+    /**
+     * @brief Look up sine and cosine of an angle in degrees
+     */
+    void SinCosDegrees(float degrees, float& sinOut, float& cosOut) const;
+
+    // Ship triangle in units of its size: nose up, tail corners below
+    static constexpr std::array<float, 6> SHIP_MESH = {0.0F, 1.0F, -1.0F, -1.0F, 1.0F, -1.0F};
+
+private:
+    GeometryCache();
+
+    static constexpr int LOD_COUNT = 4;
+    static constexpr std::array<int, LOD_COUNT> LOD_SEGMENTS = {8, 16, 32, 64};
+    static constexpr float TARGET_EDGE_PIXELS = 4.0F; // Desired on-screen length of one circle edge
+    static constexpr int ANGLE_TABLE_SIZE = 1024;
+
+    std::array<CircleTable, LOD_COUNT> mCircles;
+    std::vector<float> mSinTable;
+    std::vector<float> mCosTable;
+};
@@ -0,0 +1,118 @@
+#include "MusicSequencer.h"
+#include "SineTable.h"
+#include <algorithm>
+
+namespace {
+    struct TrackDefinition {
+        const float* notes; // Frequencies in Hz, one per step, looping
+        std::size_t noteCount;
+        std::array<float, MusicSequencer::HARMONIC_COUNT> harmonicGains; // Fundamental, 2nd, 3rd harmonic
+    };
+
+    // Techno-style ambient music - lower pitch, faster tempo, more electronic
+    constexpr std::array<float, 10> BASS_NOTES = {
+        65.41F, 73.42F, 82.41F, 98.00F, 110.00F,   // C2, D2, E2, G2, A2 - bass range
+        130.81F, 146.83F, 164.81F, 196.00F, 220.00F // C3, D3, E3, G3, A3 - low mid range
+    };
+
+    constexpr std::array<TrackDefinition, MusicSequencer::TRACK_COUNT> TRACKS = {{
+        // Bass line with added harmonics for tech feel
+        {BASS_NOTES.data(), BASS_NOTES.size(), {1.0F, 0.3F, 0.15F}}
+    }};
+
+    constexpr float STEP_SECONDS = 0.8F;        // Faster tempo
+    constexpr float TRANSITION_SECONDS = 0.05F; // Smooth note transitions to prevent pops
+    constexpr int PULSES_PER_SECOND = 4;        // Pulsing envelope for electronic feel
+    constexpr float MUSIC_LEVEL = 0.15F;
+}
+
+MusicSequencer::MusicSequencer(int sampleRate)
+    : mSampleTime(1.0F / static_cast<float>(sampleRate))
+    , mStepFrames(static_cast<std::int64_t>(STEP_SECONDS * static_cast<float>(sampleRate)))
+    , mTransitionFrames(static_cast<std::int64_t>(TRANSITION_SECONDS * static_cast<float>(sampleRate)))
+    , mPulseFrames(sampleRate / PULSES_PER_SECOND)
+    , mFrame(0)
+    , mTracks()
+{
+    Restart();
+}
+
+void MusicSequencer::Restart() {
+    mFrame = 0;
+    for (auto& track : mTracks) {
+        track.phases.fill(0.0F);
+        track.noteIndex = 0;
+        track.noteFrame = 0;
+    }
+}
+
+void MusicSequencer::Render(float* left, float* right, int frames, float volume) {
+    float level = volume * MUSIC_LEVEL;
+
+    // Split the block wherever a track changes note, so every change lands on its exact
+    // sample, and where a note's fade-in ends, so spans are either ramping or steady
+    int offset = 0;
+    while (offset < frames) {
+        std::int64_t span = frames - offset;
+        for (const auto& track : mTracks) {
+            std::int64_t boundary = track.noteFrame < mTransitionFrames ? mTransitionFrames : mStepFrames;
+            span = std::min(span, boundary - track.noteFrame);
+        }
+
+        RenderSpan(left + offset, right + offset, static_cast<int>(span), level);
+        offset += static_cast<int>(span);
+    }
+}
+
+void MusicSequencer::RenderSpan(float* left, float* right, int frames, float level) {
+    // The pulse is slow next to a block, so it is ramped linearly across the span
+    float envelope = Pulse(mFrame);
+    float envelopeStep = (Pulse(mFrame + frames) - envelope) / static_cast<float>(frames);
+    float rampStep = 1.0F / static_cast<float>(mTransitionFrames);
+
+    for (std::size_t index = 0; index < TRACKS.size(); ++index) {
+        const TrackDefinition& definition = TRACKS[index];
+        TrackState& track = mTracks[index];
+
+        std::array<float, HARMONIC_COUNT> phases = track.phases;
+        std::array<float, HARMONIC_COUNT> phaseSteps{};
+        float baseStep = definition.notes[track.noteIndex] * mSampleTime;
+        for (std::size_t harmonic = 0; harmonic < HARMONIC_COUNT; ++harmonic) {
+            phaseSteps[harmonic] = baseStep * static_cast<float>(harmonic + 1);
+        }
+
+        // Spans never cross the end of the fade-in, so the ramp stays within [0, 1]
+        bool fading = track.noteFrame < mTransitionFrames;
+        float transition = fading ? static_cast<float>(track.noteFrame) * rampStep : 1.0F;
+        float transitionStep = fading ? rampStep : 0.0F;
+        float gain = envelope;
+        for (int i = 0; i < frames; ++i) {
+            float wave = 0.0F;
+            for (std::size_t harmonic = 0; harmonic < HARMONIC_COUNT; ++harmonic) {
+                wave += definition.harmonicGains[harmonic] * SINE(phases[harmonic]);
+                phases[harmonic] = WrapPhase(phases[harmonic] + phaseSteps[harmonic]);
+            }
+
+            // Music sits in the center of the stereo field
+            float value = level * gain * transition * wave;
+            left[i] += value;
+            right[i] += value;
+            gain += envelopeStep;
+            transition += transitionStep;
+        }
+        track.phases = phases;
+
+        track.noteFrame += frames;
+        if (track.noteFrame == mStepFrames) {
+            track.noteFrame = 0;
+            track.noteIndex = (track.noteIndex + 1) % definition.noteCount;
+        }
+    }
+
+    mFrame += frames;
+}
+
+float MusicSequencer::Pulse(std::int64_t frame) const {
+    float cycles = static_cast<float>(frame % mPulseFrames) / static_cast<float>(mPulseFrames);
+    return 0.3F + (0.7F * (0.5F + (0.5F * SINE(cycles))));
+}
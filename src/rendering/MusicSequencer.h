@@ -0,0 +1,53 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Plays the background music pattern into a float mix bus
+ *
+ * The song is a table of tracks in MusicSequencer.cpp, each a looping
+ * sequence of notes played by a small stack of harmonic oscillators. All
+ * playback state lives in the instance and is counted in whole samples, so
+ * note changes land on their exact sample even in the middle of a block,
+ * long sessions do not drift, and any number of mixers can play the music
+ * independently. Render adds one block at a time and costs a table lookup
+ * per oscillator per sample.
+ */
+class MusicSequencer {
+public:
+    explicit MusicSequencer(int sampleRate);
+
+    /**
+     * @brief Rewind every track to the first note of its pattern
+     */
+    void Restart();
+
+    /**
+     * @brief Add the next frames of music to both channels of the bus
+     * @param volume Music volume, 0.0 to 1.0
+     */
+    void Render(float* left, float* right, int frames, float volume);
+
+    static constexpr std::size_t TRACK_COUNT = 1;
+    static constexpr std::size_t HARMONIC_COUNT = 3;
+
+private:
+    struct TrackState {
+        std::array<float, HARMONIC_COUNT> phases; // In cycles, kept across notes so changes do not click
+        std::size_t noteIndex;
+        std::int64_t noteFrame; // Frames played of the current note
+    };
+
+    void RenderSpan(float* left, float* right, int frames, float level);
+    float Pulse(std::int64_t frame) const;
+
+    float mSampleTime;
+    std::int64_t mStepFrames;       // Length of one pattern step
+    std::int64_t mTransitionFrames; // Fade-in at the start of each note
+    std::int64_t mPulseFrames;      // Period of the volume pulse
+    std::int64_t mFrame;            // Frames since the last restart, for the pulse
+
+    std::array<TrackState, TRACK_COUNT> mTracks;
+};
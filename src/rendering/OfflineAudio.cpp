@@ -0,0 +1,210 @@
+#include "OfflineAudio.h"
+#include <SDL2/SDL.h>
+#include <SDL_log.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <numeric>
+
+namespace {
+    constexpr std::int64_t PEW_INTERVAL = AudioManager::SAMPLE_RATE / 16;  // Frames between scripted shots
+    constexpr std::int64_t BOOM_INTERVAL = AudioManager::SAMPLE_RATE / 2;  // Frames between scripted explosions
+    constexpr float SWEEP_SECONDS = 4.0F; // Shots cross the view left to right once per sweep
+    constexpr int BURST_PEWS = 32;        // Mid-render volley that overflows the voice pool
+    constexpr int BURST_BOOMS = 8;
+
+    struct ScriptPosition {
+        float posX;
+        float posY;
+    };
+
+    // Center, both edges, just off screen (attenuated) and far off screen (culled)
+    constexpr std::array<ScriptPosition, 5> BOOM_POSITIONS = {{
+        {0.0F, 0.0F}, {-0.9F, 0.2F}, {0.9F, -0.2F}, {1.5F, 0.0F}, {3.0F, 0.0F}
+    }};
+
+    constexpr std::array<int, 6> BENCHMARK_VOICE_COUNTS = {0, 1, 4, 8, 12, 16};
+    constexpr int WARMUP_CALLBACKS = 50;
+    constexpr int TIMED_CALLBACKS = 2000;
+
+    void WriteLittleEndian(std::ofstream& file, std::uint32_t value, int bytes) {
+        for (int i = 0; i < bytes; ++i) {
+            file.put(static_cast<char>((value >> (8 * i)) & 0xFFU));
+        }
+    }
+
+    constexpr std::uint32_t BYTES_PER_SAMPLE = sizeof(Sint16);
+    constexpr std::uint32_t BLOCK_ALIGN = AudioManager::CHANNELS * BYTES_PER_SAMPLE;
+    constexpr std::uint32_t WAV_HEADER_TAIL = 36; // Header bytes counted in the RIFF size, before the data
+    constexpr std::uint64_t MAX_WAV_DATA_BYTES = 0xFFFFFFFFULL - WAV_HEADER_TAIL; // RIFF sizes are 32-bit
+
+    void WriteWavHeader(std::ofstream& file, std::uint32_t dataBytes) {
+        file.write("RIFF", 4);
+        WriteLittleEndian(file, WAV_HEADER_TAIL + dataBytes, 4);
+        file.write("WAVE", 4);
+        file.write("fmt ", 4);
+        WriteLittleEndian(file, 16, 4); // Format chunk size
+        WriteLittleEndian(file, 1, 2);  // PCM
+        WriteLittleEndian(file, AudioManager::CHANNELS, 2);
+        WriteLittleEndian(file, AudioManager::SAMPLE_RATE, 4);
+        WriteLittleEndian(file, AudioManager::SAMPLE_RATE * BLOCK_ALIGN, 4);
+        WriteLittleEndian(file, BLOCK_ALIGN, 2);
+        WriteLittleEndian(file, BYTES_PER_SAMPLE * 8, 2);
+        file.write("data", 4);
+        WriteLittleEndian(file, dataBytes, 4);
+    }
+
+    double Percentile(std::vector<double> values, double fraction) {
+        if (values.empty()) {
+            return 0.0;
+        }
+        auto index = static_cast<std::size_t>(fraction * static_cast<double>(values.size() - 1));
+        std::nth_element(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(index), values.end());
+        return values[index];
+    }
+}
+
+OfflineAudio::OfflineAudio()
+    : mAudio()
+    , mCamera()
+    , mBuffer(static_cast<std::size_t>(AudioManager::SAMPLES) * AudioManager::CHANNELS)
+    , mEventCount(0)
+{
+    mAudio.InitializeOffline();
+    mAudio.SetCamera(&mCamera);
+}
+
+bool OfflineAudio::RenderToWav(const std::string& path, std::uint32_t seconds) {
+    // Sizes in 64-bit so a long render is refused rather than written with a wrapped header
+    std::uint64_t totalFrames = static_cast<std::uint64_t>(seconds) * AudioManager::SAMPLE_RATE;
+    std::uint64_t dataBytes = totalFrames * BLOCK_ALIGN;
+    if (dataBytes > MAX_WAV_DATA_BYTES) {
+        SDL_Log("Cannot render %u s of audio, a WAV file holds at most %llu s", seconds,
+                static_cast<unsigned long long>(MAX_WAV_DATA_BYTES / BLOCK_ALIGN / AudioManager::SAMPLE_RATE));
+        return false;
+    }
+
+    std::ofstream file(path, std::ios::binary);
+    if (!file) {
+        SDL_Log("Cannot write audio render to '%s'", path.c_str());
+        return false;
+    }
+
+    WriteWavHeader(file, static_cast<std::uint32_t>(dataBytes));
+
+    mAudio.PlayBackgroundMusic();
+    mAudio.PlayBeep();
+
+    int peak = 0;
+    double mixMicroseconds = 0.0;
+    std::uint32_t callbacks = 0;
+    for (std::uint64_t frame = 0; frame < totalFrames; frame += AudioManager::SAMPLES) {
+        PostScriptedEvents(frame, frame + AudioManager::SAMPLES, seconds);
+        mixMicroseconds += TimeCallback();
+        ++callbacks;
+
+        // The last callback is cut to the requested length
+        auto frames = static_cast<std::uint32_t>(std::min<std::uint64_t>(AudioManager::SAMPLES, totalFrames - frame));
+        for (std::size_t i = 0; i < static_cast<std::size_t>(frames) * AudioManager::CHANNELS; ++i) {
+            peak = std::max(peak, std::abs(static_cast<int>(mBuffer[i])));
+            WriteLittleEndian(file, static_cast<std::uint16_t>(mBuffer[i]), 2);
+        }
+    }
+
+    if (!file) {
+        SDL_Log("Failed while writing audio render to '%s'", path.c_str());
+        return false;
+    }
+
+    SDL_Log("Rendered %u s of audio to %s: %u callbacks, mean %.2f us per callback, peak %.1f%% of full scale",
+            seconds, path.c_str(), callbacks, mixMicroseconds / static_cast<double>(callbacks),
+            100.0 * static_cast<double>(peak) / 32767.0);
+    return true;
+}
+
+void OfflineAudio::RunBenchmark() {
+    double budget = 1.0e6 * AudioManager::SAMPLES / AudioManager::SAMPLE_RATE;
+    SDL_Log("Audio benchmark: %d-frame callbacks at %d Hz, %.0f us budget each", AudioManager::SAMPLES,
+            AudioManager::SAMPLE_RATE, budget);
+
+    std::vector<double> timings;
+    timings.reserve(TIMED_CALLBACKS);
+
+    auto run = [&](int voices, const char* label) {
+        for (int i = 0; i < WARMUP_CALLBACKS; ++i) {
+            FillVoices(voices);
+            TimeCallback();
+        }
+
+        timings.clear();
+        int activeVoices = 0;
+        for (int i = 0; i < TIMED_CALLBACKS; ++i) {
+            FillVoices(voices);
+            timings.push_back(TimeCallback());
+            activeVoices += mAudio.GetActiveVoiceCount();
+        }
+
+        double mean = std::accumulate(timings.begin(), timings.end(), 0.0) / static_cast<double>(timings.size());
+        SDL_Log("  %2d voices%s (%.1f active): mean %.2f us, p95 %.2f us, max %.2f us (%.2f%% of budget)",
+                voices, label, static_cast<double>(activeVoices) / TIMED_CALLBACKS, mean, Percentile(timings, 0.95),
+                *std::max_element(timings.begin(), timings.end()), 100.0 * mean / budget);
+    };
+
+    // Ascending, so topping up is enough to move from one count to the next
+    for (int voices : BENCHMARK_VOICE_COUNTS) {
+        run(voices, "");
+    }
+
+    mAudio.PlayBackgroundMusic();
+    run(BENCHMARK_VOICE_COUNTS.back(), " + music");
+    mAudio.StopBackgroundMusic();
+}
+
+void OfflineAudio::PostScriptedEvents(std::int64_t firstFrame, std::int64_t endFrame, std::uint32_t seconds) {
+    // Steady fire sweeping across the stereo field
+    for (std::int64_t frame = ((firstFrame + PEW_INTERVAL - 1) / PEW_INTERVAL) * PEW_INTERVAL; frame < endFrame;
+         frame += PEW_INTERVAL) {
+        float sweep = std::fmod(static_cast<float>(frame) / (SWEEP_SECONDS * AudioManager::SAMPLE_RATE), 1.0F);
+        mAudio.PlayPew(-1.0F + (2.0F * sweep), 0.0F);
+    }
+
+    // Explosions cycling through on- and off-screen positions
+    for (std::int64_t frame = ((firstFrame + BOOM_INTERVAL - 1) / BOOM_INTERVAL) * BOOM_INTERVAL; frame < endFrame;
+         frame += BOOM_INTERVAL) {
+        const ScriptPosition& position = BOOM_POSITIONS[static_cast<std::size_t>(frame / BOOM_INTERVAL) % BOOM_POSITIONS.size()];
+        mAudio.PlayBoom(position.posX, position.posY);
+    }
+
+    // One volley halfway through, far more sounds than voices
+    std::int64_t burstFrame = static_cast<std::int64_t>(seconds) * AudioManager::SAMPLE_RATE / 2;
+    if (burstFrame >= firstFrame && burstFrame < endFrame) {
+        for (int i = 0; i < BURST_PEWS; ++i) {
+            mAudio.PlayPew(-1.0F + (2.0F * static_cast<float>(i) / BURST_PEWS), 0.5F);
+        }
+        for (int i = 0; i < BURST_BOOMS; ++i) {
+            mAudio.PlayBoom(-1.0F + (2.0F * static_cast<float>(i) / BURST_BOOMS), -0.5F);
+        }
+    }
+}
+
+void OfflineAudio::FillVoices(int target) {
+    // Alternate sounds so the pool can fill past either one's instance limit
+    int missing = target - mAudio.GetActiveVoiceCount();
+    for (int i = 0; i < missing; ++i) {
+        float posX = std::sin(static_cast<float>(mEventCount) * 2.4F);
+        if ((mEventCount++ % 2) == 0) {
+            mAudio.PlayPew(posX, 0.0F);
+        } else {
+            mAudio.PlayBoom(posX, 0.0F);
+        }
+    }
+}
+
+double OfflineAudio::TimeCallback() {
+    Uint64 start = SDL_GetPerformanceCounter();
+    mAudio.MixOffline(mBuffer.data(), AudioManager::SAMPLES);
+    Uint64 end = SDL_GetPerformanceCounter();
+    return 1.0e6 * static_cast<double>(end - start) / static_cast<double>(SDL_GetPerformanceFrequency());
+}
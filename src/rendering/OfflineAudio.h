@@ -0,0 +1,53 @@
+#pragma once
+
+#include "AudioManager.h"
+#include "Camera.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Drives the audio mixer without a sound device
+ *
+ * Plays both sides of AudioManager on one thread: sounds are posted through
+ * the public API as the game would, and each device callback is replaced by
+ * a direct MixOffline call. Used to listen to and diff the mixer's output
+ * and to time the audio thread on headless machines. Events take effect at
+ * callback boundaries, as they do with a real device.
+ */
+class OfflineAudio {
+public:
+    OfflineAudio();
+
+    // Non-copyable, the audio manager keeps a pointer to the camera
+    OfflineAudio(const OfflineAudio&) = delete;
+    OfflineAudio& operator=(const OfflineAudio&) = delete;
+
+    /**
+     * @brief Mix a fixed script of combat sounds over the music into a WAV file
+     *
+     * The script is deterministic, so two renders of the same build are
+     * byte-identical and any difference comes from a mixer change.
+     * @param path Output file, 16-bit stereo PCM
+     * @return false if the file cannot be written
+     */
+    bool RenderToWav(const std::string& path, std::uint32_t seconds);
+
+    /**
+     * @brief Log the cost of one device callback at increasing voice counts
+     *
+     * Voices are topped up before every callback so the pool stays at the
+     * target count; a last run adds the background music on a full pool.
+     */
+    void RunBenchmark();
+
+private:
+    void PostScriptedEvents(std::int64_t firstFrame, std::int64_t endFrame, std::uint32_t seconds);
+    void FillVoices(int target);
+    double TimeCallback();
+
+    AudioManager mAudio;
+    Camera mCamera; // Default view; scripted positions are relative to it
+    std::vector<Sint16> mBuffer; // One callback of interleaved samples
+    std::uint32_t mEventCount;   // Spreads generated sounds across the stereo field
+};
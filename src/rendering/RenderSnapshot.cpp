@@ -0,0 +1,30 @@
+#include "RenderSnapshot.h"
+
+void RenderSnapshot::Clear() {
+    ships.clear();
+    planets.clear();
+    projectilePosX.clear();
+    projectilePosY.clear();
+    dragActive = false;
+}
+
+RenderSnapshotBuffer::RenderSnapshotBuffer()
+    : mSnapshots()
+    , mWriteIndex(0)
+    , mReadMutex()
+{
+}
+
+void RenderSnapshotBuffer::Publish() {
+    std::lock_guard<std::mutex> lock(mReadMutex);
+    mWriteIndex = 1 - mWriteIndex;
+}
+
+const RenderSnapshot& RenderSnapshotBuffer::BeginRead() {
+    mReadMutex.lock();
+    return mSnapshots[1 - mWriteIndex];
+}
+
+void RenderSnapshotBuffer::EndRead() {
+    mReadMutex.unlock();
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "../components/Components.h"
+#include "BatchRenderer.h"
+#include "Camera.h"
+#include <array>
+#include <mutex>
+#include <vector>
+
+/**
+ * @brief Draw data for one visible ship, copied out of the ECS
+ */
+struct ShipDrawData {
+    float posX;
+    float posY;
+    float angle;
+    float healthPercent;
+    float selectionRadius;
+    Components::SpacecraftType type;
+    Components::AIState aiState;
+    bool isSelected;
+};
+
+/**
+ * @brief Draw data for one visible planet
+ */
+struct PlanetDrawData {
+    float posX;
+    float posY;
+    float radius;
+    float healthPercent;
+    float selectionRadius;
+    BatchColor color;
+    bool isAlive;
+    bool isSelected;
+};
+
+/**
+ * @brief Everything the world pass needs to draw one frame
+ *
+ * Filled on the simulation side after all systems have updated, then drawn
+ * without touching the registry, so drawing a frame can overlap with
+ * simulating the next one.
+ */
+struct RenderSnapshot {
+    Camera camera;
+    std::vector<ShipDrawData> ships;
+    std::vector<PlanetDrawData> planets;
+    std::vector<float> projectilePosX;
+    std::vector<float> projectilePosY;
+
+    // Drag selection box in window pixels
+    bool dragActive = false;
+    int dragStartX = 0;
+    int dragStartY = 0;
+    int dragEndX = 0;
+    int dragEndY = 0;
+
+    /**
+     * @brief Empty the lists, keeping their storage for the next frame
+     */
+    void Clear();
+};
+
+/**
+ * @brief Double buffer of render snapshots
+ *
+ * The simulation fills the write snapshot and publishes it; the renderer
+ * draws the most recently published one between BeginRead and EndRead.
+ * Publishing waits for an in-progress read to finish, so the snapshot being
+ * drawn is never swapped out underneath the renderer, while extraction into
+ * the other buffer runs freely alongside it.
+ */
+class RenderSnapshotBuffer {
+public:
+    RenderSnapshotBuffer();
+
+    // Simulation side
+    RenderSnapshot& GetWriteSnapshot() { return mSnapshots[mWriteIndex]; }
+    void Publish();
+
+    // Render side
+    const RenderSnapshot& BeginRead();
+    void EndRead();
+
+private:
+    std::array<RenderSnapshot, 2> mSnapshots;
+    std::size_t mWriteIndex;
+    std::mutex mReadMutex;
+};
@@ -1,43 +1,43 @@
 #include "Renderer.h"
 #include "../components/Components.h"
+#include "../core/ProjectilePool.h"
+#include "../systems/SpatialIndexSystem.h"
+#include "BatchRenderer.h"
+#include "RenderSnapshot.h"
+#include "TextRenderer.h"
+#include "UIDrawList.h"
 #include <GL/gl.h>
 #include <SDL_log.h>
+#include <algorithm>
 #include <cmath>
-
-// FreeType includes
-#include <ft2build.h>
-#include FT_FREETYPE_H
-#include <unordered_map>
-#include <iostream>
-
-namespace {
-    // FreeType character structure
-    struct Character {
-        unsigned int textureID;
-        int width;
-        int height;
-        int bearingX;
-        int bearingY;
-        unsigned int advance;
-    };
-
-    // Static FreeType data
-    FT_Library ftLibrary;
-    FT_Face ftFace;
-    std::unordered_map<char, Character> characters;
-}
+#include <cstdint>
 
 Renderer::Renderer(ECSRegistry& registry)
     : mRegistry(registry)
+    , mCamera()
+    , mVisibleShips()
+    , mVisiblePlanets()
+    , mSnapshots()
+    , mDensityPlayer()
+    , mDensityEnemy()
+    , mBatch(std::make_unique<BatchRenderer>())
+    , mText(std::make_unique<TextRenderer>())
+    , mAIStateLabels()
     , mWindowWidth(0)  // Will be set in Initialize()
     , mWindowHeight(0) // Will be set in Initialize()
-    , mTextRenderingInitialized(false)
     , mDragSelectionActive(false)
     , mDragStartX(0)
     , mDragStartY(0)
     , mDragEndX(0)
     , mDragEndY(0)
 {
+    mAIStateLabels = {{
+        {mText->Intern("SEARCH"), BatchColor::FromFloat(0.7F, 0.7F, 0.7F)},   // Gray
+        {mText->Intern("APPROACH"), BatchColor::FromFloat(1.0F, 1.0F, 0.0F)}, // Yellow
+        {mText->Intern("ENGAGE"), BatchColor::FromFloat(1.0F, 0.0F, 0.0F)},   // Red
+        {mText->Intern("RETREAT"), BatchColor::FromFloat(0.0F, 0.0F, 1.0F)},  // Blue
+        {mText->Intern("REGROUP"), BatchColor::FromFloat(0.0F, 1.0F, 0.0F)}   // Green
+    }};
 }
 
 Renderer::~Renderer() {
@@ -47,10 +47,12 @@ Renderer::~Renderer() {
 bool Renderer::Initialize(int windowWidth, int windowHeight) {
     mWindowWidth = windowWidth;
     mWindowHeight = windowHeight;
+    mCamera.SetViewport(windowWidth, windowHeight);
     
     SetupOpenGL();
+    mBatch->Initialize();
     
-    if (!InitializeTextRendering()) {
+    if (!mText->Initialize()) {
         SDL_Log("Warning: Failed to initialize text rendering");
     }
     
@@ -59,7 +61,12 @@ bool Renderer::Initialize(int windowWidth, int windowHeight) {
 }
 
 void Renderer::Shutdown() {
-    CleanupTextRendering();
+    if (mBatch) {
+        mBatch->Shutdown();
+    }
+    if (mText) {
+        mText->Shutdown();
+    }
     SDL_Log("Renderer shutdown");
 }
 
@@ -67,25 +74,126 @@ void Renderer::BeginFrame() {
     glClearColor(0.0F, 0.0F, 0.0F, 1.0F);
     glClear(GL_COLOR_BUFFER_BIT);
     
-    glMatrixMode(GL_PROJECTION);
-    glLoadIdentity();
-    glOrtho(-1.0, 1.0, -WORLD_ASPECT_RATIO, WORLD_ASPECT_RATIO, -1.0, 1.0);
-    
-    glMatrixMode(GL_MODELVIEW);
-    glLoadIdentity();
+    ApplyScreenProjection();
 }
 
 void Renderer::RenderWorld() {
-    RenderPlanets();
-    RenderSpacecraft();
-    RenderProjectiles();
-    RenderSelectionBoxes();
-    RenderDragSelectionBox();
+    // Draw the last published snapshot; the registry is not touched from here on
+    const RenderSnapshot& snapshot = mSnapshots.BeginRead();
+    
+    ApplyWorldProjection(snapshot.camera);
+    mDetailLevel = SelectDetailLevel(snapshot);
+    
+    // World shapes are queued and drawn together; text and the drag box go on top
+    mBatch->Begin();
+    RenderPlanets(snapshot);
+    switch (mDetailLevel) {
+        case DetailLevel::Full:
+            RenderSpacecraft(snapshot);
+            break;
+        case DetailLevel::Dots:
+            RenderSpacecraftDots(snapshot);
+            break;
+        case DetailLevel::Density:
+            RenderSpacecraftDensity(snapshot);
+            break;
+    }
+    RenderProjectiles(snapshot);
+    RenderSelectionBoxes(snapshot);
+    mBatch->Flush();
+    
+    // Labels are unreadable once ships shrink to dots
+    if (mDetailLevel == DetailLevel::Full) {
+        RenderSpacecraftLabels(snapshot);
+    }
+    mText->Flush();
+    
+    // The drag box and UI are in screen space
+    ApplyScreenProjection();
+    RenderDragSelectionBox(snapshot);
+    
+    mSnapshots.EndRead();
+}
+
+void Renderer::ExtractSnapshot() {
+    using namespace Components;
+    
+    RenderSnapshot& snapshot = mSnapshots.GetWriteSnapshot();
+    snapshot.Clear();
+    snapshot.camera = mCamera;
+    
+    CollectVisibleEntities();
+    
+    snapshot.ships.reserve(mVisibleShips.size());
+    for (EntityID entity : mVisibleShips) {
+        auto* spacecraft = mRegistry.GetComponent<Spacecraft>(entity);
+        auto* position = mRegistry.GetComponent<Position>(entity);
+        auto* health = mRegistry.GetComponent<Health>(entity);
+        if (!spacecraft || !position || !health || !health->isAlive) {
+            continue;
+        }
+        
+        auto* selectable = mRegistry.GetComponent<Selectable>(entity);
+        snapshot.ships.push_back({
+            position->posX,
+            position->posY,
+            spacecraft->angle,
+            static_cast<float>(health->currentHP) / static_cast<float>(health->maxHP),
+            selectable ? selectable->selectionRadius : 0.0F,
+            spacecraft->type,
+            spacecraft->aiState,
+            selectable && selectable->isSelected
+        });
+    }
+    
+    snapshot.planets.reserve(mVisiblePlanets.size());
+    for (EntityID entity : mVisiblePlanets) {
+        auto* planet = mRegistry.GetComponent<Planet>(entity);
+        auto* position = mRegistry.GetComponent<Position>(entity);
+        auto* renderable = mRegistry.GetComponent<Renderable>(entity);
+        if (!planet || !position || !renderable) {
+            continue;
+        }
+        
+        auto* health = mRegistry.GetComponent<Health>(entity);
+        auto* selectable = mRegistry.GetComponent<Selectable>(entity);
+        bool isAlive = health && health->isAlive;
+        snapshot.planets.push_back({
+            position->posX,
+            position->posY,
+            planet->radius,
+            isAlive ? static_cast<float>(health->currentHP) / static_cast<float>(health->maxHP) : 0.0F,
+            selectable ? selectable->selectionRadius : 0.0F,
+            BatchColor::FromFloat(renderable->red, renderable->green, renderable->blue),
+            isAlive,
+            selectable && selectable->isSelected
+        });
+    }
+    
+    if (mProjectilePool != nullptr) {
+        const float* posX = mProjectilePool->GetPosX();
+        const float* posY = mProjectilePool->GetPosY();
+        for (std::size_t i = 0; i < mProjectilePool->Size(); ++i) {
+            if (mCamera.IsVisible(posX[i], posY[i], PROJECTILE_RADIUS)) {
+                snapshot.projectilePosX.push_back(posX[i]);
+                snapshot.projectilePosY.push_back(posY[i]);
+            }
+        }
+    }
+    
+    snapshot.dragActive = mDragSelectionActive;
+    snapshot.dragStartX = mDragStartX;
+    snapshot.dragStartY = mDragStartY;
+    snapshot.dragEndX = mDragEndX;
+    snapshot.dragEndY = mDragEndY;
+    
+    mSnapshots.Publish();
 }
 
 void Renderer::RenderUI() {
-    // UI rendering will be handled by UISystem
-    // This method is kept for interface compatibility
+    // Submitted UI panels are drawn here: all shapes in one batch, then all text
+    mBatch->Flush();
+    mText->Flush();
 }
 
 void Renderer::EndFrame() {
@@ -95,6 +203,7 @@ void Renderer::EndFrame() {
 void Renderer::OnWindowResize(int newWidth, int newHeight) {
     mWindowWidth = newWidth;
     mWindowHeight = newHeight;
+    mCamera.SetViewport(newWidth, newHeight);
     glViewport(0, 0, newWidth, newHeight);
 }
 
@@ -104,178 +213,267 @@ void Renderer::SetupOpenGL() {
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 }
 
-void Renderer::RenderSpacecraft() {
+void Renderer::ApplyWorldProjection(const Camera& camera) {
+    glMatrixMode(GL_PROJECTION);
+    glLoadIdentity();
+    glOrtho(camera.GetMinX(), camera.GetMaxX(), camera.GetMinY(), camera.GetMaxY(), -1.0, 1.0);
+    
+    glMatrixMode(GL_MODELVIEW);
+    glLoadIdentity();
+    
+    mBatch->SetPixelsPerUnit(camera.GetPixelsPerUnit());
+}
+
+void Renderer::ApplyScreenProjection() {
+    glMatrixMode(GL_PROJECTION);
+    glLoadIdentity();
+    glOrtho(-1.0, 1.0, -WORLD_ASPECT_RATIO, WORLD_ASPECT_RATIO, -1.0, 1.0);
+    
+    glMatrixMode(GL_MODELVIEW);
+    glLoadIdentity();
+}
+
+void Renderer::CollectVisibleEntities() {
     using namespace Components;
     
+    mVisibleShips.clear();
+    mVisiblePlanets.clear();
+    
+    if (mSpatialIndex != nullptr) {
+        mSpatialIndex->QueryShips(mCamera.GetMinX() - SHIP_CULL_MARGIN, mCamera.GetMinY() - SHIP_CULL_MARGIN,
+                                  mCamera.GetMaxX() + SHIP_CULL_MARGIN, mCamera.GetMaxY() + SHIP_CULL_MARGIN,
+                                  mVisibleShips);
+        mSpatialIndex->QueryPlanets(mCamera.GetMinX() - PLANET_CULL_MARGIN, mCamera.GetMinY() - PLANET_CULL_MARGIN,
+                                    mCamera.GetMaxX() + PLANET_CULL_MARGIN, mCamera.GetMaxY() + PLANET_CULL_MARGIN,
+                                    mVisiblePlanets);
+        return;
+    }
+    
+    // No index attached; test every entity against the view instead
     mRegistry.ForEach<Spacecraft>([this](EntityID entity, Spacecraft& spacecraft) {
+        (void)spacecraft;
         auto* position = mRegistry.GetComponent<Position>(entity);
-        auto* health = mRegistry.GetComponent<Health>(entity);
-        auto* renderable = mRegistry.GetComponent<Renderable>(entity);
-        
-        if (!position || !health || !health->isAlive) {
-            return;
+        if (position && mCamera.IsVisible(position->posX, position->posY, SHIP_CULL_MARGIN)) {
+            mVisibleShips.push_back(entity);
         }
-        
+    });
+    mRegistry.ForEach<Planet>([this](EntityID entity, Planet& planet) {
+        (void)planet;
+        auto* position = mRegistry.GetComponent<Position>(entity);
+        if (position && mCamera.IsVisible(position->posX, position->posY, PLANET_CULL_MARGIN)) {
+            mVisiblePlanets.push_back(entity);
+        }
+    });
+}
+
+void Renderer::RenderSpacecraft(const RenderSnapshot& snapshot) {
+    using namespace Components;
+    
+    const BatchColor enemyColor = BatchColor::FromFloat(1.0F, 0.2F, 0.2F);    // Red for enemies
+    const BatchColor selectedColor = BatchColor::FromFloat(0.0F, 1.0F, 0.0F); // Green for selected
+    const BatchColor playerColor = BatchColor::FromFloat(1.0F, 0.8F, 0.2F);   // Yellow for player
+    
+    constexpr float HEALTH_BAR_WIDTH = 0.08F;
+    constexpr float HEALTH_BAR_HEIGHT = 0.012F;
+    constexpr float HEALTH_BAR_OFFSET = 0.045F;
+    
+    for (const ShipDrawData& ship : snapshot.ships) {
         // Set color based on type
-        if (spacecraft.type == SpacecraftType::Enemy) {
-            glColor3f(1.0F, 0.2F, 0.2F); // Red for enemies
-        } else {
-            // Check if selected
-            auto* selectable = mRegistry.GetComponent<Selectable>(entity);
-            if (selectable && selectable->isSelected) {
-                glColor3f(0.0F, 1.0F, 0.0F); // Green for selected
-            } else {
-                glColor3f(1.0F, 0.8F, 0.2F); // Yellow for player
-            }
+        BatchColor color = playerColor;
+        if (ship.type == SpacecraftType::Enemy) {
+            color = enemyColor;
+        } else if (ship.isSelected) {
+            color = selectedColor;
         }
         
-        DrawTriangle(position->posX, position->posY, spacecraft.angle);
+        mBatch->AddShip(ship.posX, ship.posY, ship.angle, TRIANGLE_SIZE, color);
         
         // Draw health bar
-        constexpr float HEALTH_BAR_WIDTH = 0.08F;
-        constexpr float HEALTH_BAR_HEIGHT = 0.012F;
-        constexpr float HEALTH_BAR_OFFSET = 0.045F;
-        
-        float healthPercent = static_cast<float>(health->currentHP) / static_cast<float>(health->maxHP);
-        DrawHealthBar(
-            position->posX - HEALTH_BAR_WIDTH / 2.0F,
-            position->posY + HEALTH_BAR_OFFSET,
+        mBatch->AddHealthBar(
+            ship.posX - HEALTH_BAR_WIDTH / 2.0F,
+            ship.posY + HEALTH_BAR_OFFSET,
             HEALTH_BAR_WIDTH,
             HEALTH_BAR_HEIGHT,
-            healthPercent
+            ship.healthPercent
         );
+    }
+}
+
+Renderer::DetailLevel Renderer::SelectDetailLevel(const RenderSnapshot& snapshot) const {
+    float shipPixels = TRIANGLE_SIZE * snapshot.camera.GetPixelsPerUnit();
+    std::size_t shipCount = snapshot.ships.size();
+    
+    if (shipPixels < DOTS_MIN_PIXELS || shipCount > DOTS_MAX_SHIPS) {
+        return DetailLevel::Density;
+    }
+    if (shipPixels < FULL_DETAIL_MIN_PIXELS || shipCount > FULL_DETAIL_MAX_SHIPS) {
+        return DetailLevel::Dots;
+    }
+    return DetailLevel::Full;
+}
+
+void Renderer::RenderSpacecraftDots(const RenderSnapshot& snapshot) {
+    using namespace Components;
+    
+    const BatchColor enemyColor = BatchColor::FromFloat(1.0F, 0.2F, 0.2F);
+    const BatchColor selectedColor = BatchColor::FromFloat(0.0F, 1.0F, 0.0F);
+    const BatchColor playerColor = BatchColor::FromFloat(1.0F, 0.8F, 0.2F);
+    
+    // Fixed on-screen size regardless of zoom
+    float halfSize = DOT_PIXELS / snapshot.camera.GetPixelsPerUnit() / 2.0F;
+    
+    for (const ShipDrawData& ship : snapshot.ships) {
+        BatchColor color = playerColor;
+        if (ship.type == SpacecraftType::Enemy) {
+            color = enemyColor;
+        } else if (ship.isSelected) {
+            color = selectedColor;
+        }
         
-        // Draw AI state text above health bar (only for enemy units)
-        if (spacecraft.type == SpacecraftType::Enemy) {
-            constexpr float AI_STATE_TEXT_OFFSET = 0.07F;
-            constexpr float AI_STATE_TEXT_SIZE = 0.02F;
+        mBatch->AddQuad(ship.posX - halfSize, ship.posY - halfSize,
+                        ship.posX + halfSize, ship.posY + halfSize, color);
+    }
+}
+
+void Renderer::RenderSpacecraftDensity(const RenderSnapshot& snapshot) {
+    using namespace Components;
+    
+    constexpr std::size_t CELL_COUNT = static_cast<std::size_t>(DENSITY_COLUMNS) * DENSITY_ROWS;
+    mDensityPlayer.assign(CELL_COUNT, 0);
+    mDensityEnemy.assign(CELL_COUNT, 0);
+    
+    const Camera& camera = snapshot.camera;
+    float minX = camera.GetMinX();
+    float minY = camera.GetMinY();
+    float cellWidth = (camera.GetMaxX() - minX) / static_cast<float>(DENSITY_COLUMNS);
+    float cellHeight = (camera.GetMaxY() - minY) / static_cast<float>(DENSITY_ROWS);
+    
+    // Bin visible ships into screen cells by faction
+    for (const ShipDrawData& ship : snapshot.ships) {
+        int column = static_cast<int>(std::floor((ship.posX - minX) / cellWidth));
+        int row = static_cast<int>(std::floor((ship.posY - minY) / cellHeight));
+        if (column < 0 || column >= DENSITY_COLUMNS || row < 0 || row >= DENSITY_ROWS) {
+            continue;
+        }
+        
+        std::size_t cell = (static_cast<std::size_t>(row) * DENSITY_COLUMNS) + static_cast<std::size_t>(column);
+        auto& counts = ship.type == SpacecraftType::Enemy ? mDensityEnemy : mDensityPlayer;
+        if (counts[cell] < UINT16_MAX) {
+            ++counts[cell];
+        }
+    }
+    
+    // One quad per occupied cell, colored by the majority faction and shaded by count
+    for (int row = 0; row < DENSITY_ROWS; ++row) {
+        for (int column = 0; column < DENSITY_COLUMNS; ++column) {
+            std::size_t cell = (static_cast<std::size_t>(row) * DENSITY_COLUMNS) + static_cast<std::size_t>(column);
+            int playerCount = mDensityPlayer[cell];
+            int enemyCount = mDensityEnemy[cell];
+            int total = playerCount + enemyCount;
+            if (total == 0) {
+                continue;
+            }
             
-            std::string aiStateText = GetAIStateString(spacecraft.aiState);
+            float alpha = std::min(1.0F, 0.25F + (static_cast<float>(total) / DENSITY_SATURATION));
+            BatchColor color = enemyCount > playerCount
+                ? BatchColor::FromFloat(1.0F, 0.2F, 0.2F, alpha)
+                : BatchColor::FromFloat(1.0F, 0.8F, 0.2F, alpha);
             
-            // Use different colors for different states
-            switch (spacecraft.aiState) {
-                case Components::AIState::Search:
-                    RenderTextCentered(aiStateText, position->posX, position->posY + AI_STATE_TEXT_OFFSET, 
-                                     AI_STATE_TEXT_SIZE, 0.7F, 0.7F, 0.7F); // Gray
-                    break;
-                case Components::AIState::Approach:
-                    RenderTextCentered(aiStateText, position->posX, position->posY + AI_STATE_TEXT_OFFSET, 
-                                     AI_STATE_TEXT_SIZE, 1.0F, 1.0F, 0.0F); // Yellow
-                    break;
-                case Components::AIState::Engage:
-                    RenderTextCentered(aiStateText, position->posX, position->posY + AI_STATE_TEXT_OFFSET, 
-                                     AI_STATE_TEXT_SIZE, 1.0F, 0.0F, 0.0F); // Red
-                    break;
-                case Components::AIState::Retreat:
-                    RenderTextCentered(aiStateText, position->posX, position->posY + AI_STATE_TEXT_OFFSET, 
-                                     AI_STATE_TEXT_SIZE, 0.0F, 0.0F, 1.0F); // Blue
-                    break;
-                case Components::AIState::Regroup:
-                    RenderTextCentered(aiStateText, position->posX, position->posY + AI_STATE_TEXT_OFFSET, 
-                                     AI_STATE_TEXT_SIZE, 0.0F, 1.0F, 0.0F); // Green
-                    break;
-            }
+            float cellMinX = minX + (static_cast<float>(column) * cellWidth);
+            float cellMinY = minY + (static_cast<float>(row) * cellHeight);
+            mBatch->AddQuad(cellMinX, cellMinY, cellMinX + cellWidth, cellMinY + cellHeight, color);
         }
-    });
+    }
 }
 
-void Renderer::RenderPlanets() {
+void Renderer::RenderSpacecraftLabels(const RenderSnapshot& snapshot) {
     using namespace Components;
     
-    mRegistry.ForEach<Planet>([this](EntityID entity, Planet& planet) {
-        auto* position = mRegistry.GetComponent<Position>(entity);
-        auto* renderable = mRegistry.GetComponent<Renderable>(entity);
-        auto* health = mRegistry.GetComponent<Health>(entity);
-        
-        if (!position || !renderable) {
-            return;
+    constexpr float AI_STATE_TEXT_OFFSET = 0.07F;
+    constexpr float AI_STATE_TEXT_SIZE = 0.02F;
+    
+    // Draw AI state text above health bar (only for enemy units)
+    for (const ShipDrawData& ship : snapshot.ships) {
+        if (ship.type != SpacecraftType::Enemy) {
+            continue;
         }
         
-        // Use renderable component for color
-        glColor3f(renderable->red, renderable->green, renderable->blue);
-        DrawCircle(position->posX, position->posY, planet.radius);
+        const AIStateLabel& label = mAIStateLabels[static_cast<std::size_t>(ship.aiState)];
+        mText->AddTextCentered(label.text, ship.posX, ship.posY + AI_STATE_TEXT_OFFSET,
+                               AI_STATE_TEXT_SIZE, label.color);
+    }
+}
+
+void Renderer::RenderPlanets(const RenderSnapshot& snapshot) {
+    const BatchColor highlightColor = BatchColor::FromFloat(0.8F, 0.8F, 0.2F); // Yellow highlight
+    
+    constexpr float PLANET_HEALTH_BAR_WIDTH = 0.12F;
+    constexpr float PLANET_HEALTH_BAR_HEIGHT = 0.015F;
+    constexpr float HIGHLIGHT_LINE_WIDTH = 4.0F;
+    
+    for (const PlanetDrawData& planet : snapshot.planets) {
+        mBatch->AddCircle(planet.posX, planet.posY, planet.radius, planet.color);
         
         // Draw health bar for planets
-        if (health && health->isAlive) {
-            constexpr float PLANET_HEALTH_BAR_WIDTH = 0.12F;
-            constexpr float PLANET_HEALTH_BAR_HEIGHT = 0.015F;
+        if (planet.isAlive) {
             float planetHealthBarOffset = planet.radius + 0.05F;
-            
-            float healthPercent = static_cast<float>(health->currentHP) / static_cast<float>(health->maxHP);
-            DrawHealthBar(
-                position->posX - PLANET_HEALTH_BAR_WIDTH / 2.0F,
-                position->posY + planetHealthBarOffset,
+            mBatch->AddHealthBar(
+                planet.posX - PLANET_HEALTH_BAR_WIDTH / 2.0F,
+                planet.posY + planetHealthBarOffset,
                 PLANET_HEALTH_BAR_WIDTH,
                 PLANET_HEALTH_BAR_HEIGHT,
-                healthPercent
+                planet.healthPercent
             );
         }
         
         // Draw selection highlight if selected
-        auto* selectable = mRegistry.GetComponent<Selectable>(entity);
-        if (selectable && selectable->isSelected) {
-            glColor3f(0.8F, 0.8F, 0.2F); // Yellow highlight
-            glLineWidth(4.0F);
-            glBegin(GL_LINE_LOOP);
-            for (int i = 0; i < CIRCLE_SEGMENTS; ++i) {
-                float theta = 2.0F * 3.14159F * static_cast<float>(i) / static_cast<float>(CIRCLE_SEGMENTS);
-                glVertex2f(
-                    position->posX + (planet.radius + 0.02F) * std::cos(theta),
-                    position->posY + (planet.radius + 0.02F) * std::sin(theta)
-                );
-            }
-            glEnd();
+        if (planet.isSelected) {
+            mBatch->AddCircleOutline(planet.posX, planet.posY, planet.radius + 0.02F,
+                                     HIGHLIGHT_LINE_WIDTH, highlightColor);
         }
-    });
+    }
 }
 
-void Renderer::RenderProjectiles() {
-    using namespace Components;
+void Renderer::RenderProjectiles(const RenderSnapshot& snapshot) {
+    const BatchColor projectileColor = BatchColor::FromFloat(1.0F, 1.0F, 1.0F); // White for projectiles
     
-    glColor3f(1.0F, 1.0F, 1.0F); // White for projectiles
+    const float* posX = snapshot.projectilePosX.data();
+    const float* posY = snapshot.projectilePosY.data();
+    std::size_t count = snapshot.projectilePosX.size();
     
-    mRegistry.ForEach<Projectile>([this](EntityID entity, Projectile& projectile) {
-        if (!projectile.isActive) {
-            return;
-        }
-        
-        auto* position = mRegistry.GetComponent<Position>(entity);
-        if (!position) {
-            return;
+    // Zoomed out, a projectile covers a pixel or two; a quad is all it needs
+    bool drawAsQuads = mDetailLevel != DetailLevel::Full;
+    for (std::size_t i = 0; i < count; ++i) {
+        if (drawAsQuads) {
+            mBatch->AddQuad(posX[i] - PROJECTILE_RADIUS, posY[i] - PROJECTILE_RADIUS,
+                            posX[i] + PROJECTILE_RADIUS, posY[i] + PROJECTILE_RADIUS, projectileColor);
+        } else {
+            mBatch->AddCircle(posX[i], posY[i], PROJECTILE_RADIUS, projectileColor);
         }
-        
-        constexpr float PROJECTILE_RADIUS = 0.012F;
-        DrawCircle(position->posX, position->posY, PROJECTILE_RADIUS);
-    });
+    }
 }
 
-void Renderer::RenderSelectionBoxes() {
-    using namespace Components;
+void Renderer::RenderSelectionBoxes(const RenderSnapshot& snapshot) {
+    const BatchColor selectionColor = BatchColor::FromFloat(0.0F, 1.0F, 0.0F); // Green for selection
+    constexpr float SELECTION_LINE_WIDTH = 2.0F;
     
-    glColor3f(0.0F, 1.0F, 0.0F); // Green for selection
-    glLineWidth(2.0F);
-    
-    mRegistry.ForEach<Selectable>([this](EntityID entity, Selectable& selectable) {
-        if (!selectable.isSelected) {
-            return;
-        }
-        
-        auto* position = mRegistry.GetComponent<Position>(entity);
-        if (!position) {
-            return;
+    for (const PlanetDrawData& planet : snapshot.planets) {
+        if (planet.isSelected) {
+            mBatch->AddCircleOutline(planet.posX, planet.posY, planet.selectionRadius,
+                                     SELECTION_LINE_WIDTH, selectionColor);
         }
-        
-        // Draw selection circle
-        glBegin(GL_LINE_LOOP);
-        for (int i = 0; i < CIRCLE_SEGMENTS; ++i) {
-            float theta = 2.0F * 3.14159F * static_cast<float>(i) / static_cast<float>(CIRCLE_SEGMENTS);
-            glVertex2f(
-                position->posX + selectable.selectionRadius * std::cos(theta),
-                position->posY + selectable.selectionRadius * std::sin(theta)
-            );
+    }
+    
+    // Rings around individual ships only read at full detail
+    if (mDetailLevel != DetailLevel::Full) {
+        return;
+    }
+    for (const ShipDrawData& ship : snapshot.ships) {
+        if (ship.isSelected) {
+            mBatch->AddCircleOutline(ship.posX, ship.posY, ship.selectionRadius,
+                                     SELECTION_LINE_WIDTH, selectionColor);
         }
-        glEnd();
-    });
+    }
 }
 
 void Renderer::SetDragSelectionBox(int startX, int startY, int endX, int endY, bool active) {
@@ -286,16 +484,16 @@ void Renderer::SetDragSelectionBox(int startX, int startY, int endX, int endY, b
     mDragEndY = endY;
 }
 
-void Renderer::RenderDragSelectionBox() {
-    if (!mDragSelectionActive) {
+void Renderer::RenderDragSelectionBox(const RenderSnapshot& snapshot) {
+    if (!snapshot.dragActive) {
         return;
     }
     
     // Convert screen coordinates to world coordinates  
-    float worldStartX = (static_cast<float>(mDragStartX) / static_cast<float>(mWindowWidth)) * 2.0F - 1.0F;
-    float worldStartY = -((static_cast<float>(mDragStartY) / static_cast<float>(mWindowHeight)) * 2.0F * WORLD_ASPECT_RATIO - WORLD_ASPECT_RATIO);
-    float worldEndX = (static_cast<float>(mDragEndX) / static_cast<float>(mWindowWidth)) * 2.0F - 1.0F;  
-    float worldEndY = -((static_cast<float>(mDragEndY) / static_cast<float>(mWindowHeight)) * 2.0F * WORLD_ASPECT_RATIO - WORLD_ASPECT_RATIO);
+    float worldStartX = (static_cast<float>(snapshot.dragStartX) / static_cast<float>(mWindowWidth)) * 2.0F - 1.0F;
+    float worldStartY = -((static_cast<float>(snapshot.dragStartY) / static_cast<float>(mWindowHeight)) * 2.0F * WORLD_ASPECT_RATIO - WORLD_ASPECT_RATIO);
+    float worldEndX = (static_cast<float>(snapshot.dragEndX) / static_cast<float>(mWindowWidth)) * 2.0F - 1.0F;  
+    float worldEndY = -((static_cast<float>(snapshot.dragEndY) / static_cast<float>(mWindowHeight)) * 2.0F * WORLD_ASPECT_RATIO - WORLD_ASPECT_RATIO);
     
     // Draw selection box outline
     glColor3f(0.0F, 1.0F, 0.0F); // Green
@@ -320,230 +518,27 @@ void Renderer::RenderDragSelectionBox() {
     glDisable(GL_BLEND);
 }
 
-void Renderer::DrawCircle(float centerX, float centerY, float radius) {
-    glBegin(GL_TRIANGLE_FAN);
-    glVertex2f(centerX, centerY);
-    for (int i = 0; i <= CIRCLE_SEGMENTS; ++i) {
-        float theta = 2.0F * 3.14159F * static_cast<float>(i) / static_cast<float>(CIRCLE_SEGMENTS);
-        glVertex2f(centerX + radius * std::cos(theta), centerY + radius * std::sin(theta));
-    }
-    glEnd();
-}
-
-std::string Renderer::GetAIStateString(Components::AIState state) const {
-    switch (state) {
-        case Components::AIState::Search:
-            return "SEARCH";
-        case Components::AIState::Approach:
-            return "APPROACH";
-        case Components::AIState::Engage:
-            return "ENGAGE";
-        case Components::AIState::Retreat:
-            return "RETREAT";
-        case Components::AIState::Regroup:
-            return "REGROUP";
-        default:
-            return "UNKNOWN";
-    }
-}
-
-void Renderer::DrawTriangle(float posX, float posY, float angle) {
-    glPushMatrix();
-    glTranslatef(posX, posY, 0.0F);
-    glRotatef(angle, 0.0F, 0.0F, 1.0F);
-    glBegin(GL_TRIANGLES);
-    glVertex2f(0.0F, TRIANGLE_SIZE);
-    glVertex2f(-TRIANGLE_SIZE, -TRIANGLE_SIZE);
-    glVertex2f(TRIANGLE_SIZE, -TRIANGLE_SIZE);
-    glEnd();
-    glPopMatrix();
-}
-
-void Renderer::DrawHealthBar(float posX, float posY, float width, float height, float healthPercent) {
-    // Background (gray)
-    glColor3f(0.3F, 0.3F, 0.3F);
-    glBegin(GL_QUADS);
-    glVertex2f(posX, posY);
-    glVertex2f(posX + width, posY);
-    glVertex2f(posX + width, posY + height);
-    glVertex2f(posX, posY + height);
-    glEnd();
-    
-    // Foreground (green)
-    glColor3f(0.2F, 1.0F, 0.2F);
-    float actualWidth = width * healthPercent;
-    glBegin(GL_QUADS);
-    glVertex2f(posX, posY);
-    glVertex2f(posX + actualWidth, posY);
-    glVertex2f(posX + actualWidth, posY + height);
-    glVertex2f(posX, posY + height);
-    glEnd();
+void Renderer::RenderText(const std::string& text, float posX, float posY, float size, float red, float green, float blue) {
+    mText->AddText(text, posX, posY, size, BatchColor::FromFloat(red, green, blue));
 }
 
-bool Renderer::InitializeTextRendering() {
-    if (mTextRenderingInitialized) {
-        return true;
-    }
-    
-    // Initialize FreeType
-    if (FT_Init_FreeType(&ftLibrary) != 0) {
-        std::cerr << "ERROR::FREETYPE: Could not init FreeType Library\n";
-        return false;
-    }
-    
-    // Try to load a font
-    const char* fontPaths[] = {
-        "/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf",
-        "/usr/share/fonts/TTF/DejaVuSans.ttf", 
-        "/System/Library/Fonts/Arial.ttf",
-        "/Windows/Fonts/arial.ttf",
-        "/usr/share/fonts/truetype/liberation/LiberationSans-Regular.ttf"
-    };
-    
-    bool fontLoaded = false;
-    for (const char* fontPath : fontPaths) {
-        if (FT_New_Face(ftLibrary, fontPath, 0, &ftFace) == 0) {
-            fontLoaded = true;
-            break;
-        }
-    }
-    
-    if (!fontLoaded) {
-        std::cerr << "ERROR::FREETYPE: Failed to load any font\n";
-        FT_Done_FreeType(ftLibrary);
-        return false;
-    }
-    
-    // Set font size
-    constexpr unsigned int FONT_SIZE = 48;
-    FT_Set_Pixel_Sizes(ftFace, 0, FONT_SIZE);
-    
-    // Disable byte-alignment restriction
-    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
-    
-    // Load first 128 ASCII characters
-    constexpr unsigned int CHAR_COUNT = 128;
-    for (unsigned char character = 0; character < CHAR_COUNT; character++) {
-        if (FT_Load_Char(ftFace, character, FT_LOAD_RENDER) != 0) {
-            std::cerr << "ERROR::FREETYPE: Failed to load Glyph " << character << '\n';
-            continue;
-        }
-        
-        unsigned int texture;
-        glGenTextures(1, &texture);
-        glBindTexture(GL_TEXTURE_2D, texture);
-        glTexImage2D(
-            GL_TEXTURE_2D,
-            0,
-            GL_RED,
-            static_cast<int>(ftFace->glyph->bitmap.width),
-            static_cast<int>(ftFace->glyph->bitmap.rows),
-            0,
-            GL_RED,
-            GL_UNSIGNED_BYTE,
-            ftFace->glyph->bitmap.buffer
-        );
-        
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-        
-        Character ch = {
-            texture,
-            static_cast<int>(ftFace->glyph->bitmap.width),
-            static_cast<int>(ftFace->glyph->bitmap.rows),
-            ftFace->glyph->bitmap_left,
-            ftFace->glyph->bitmap_top,
-            static_cast<unsigned int>(ftFace->glyph->advance.x)
-        };
-        characters.insert(std::pair<char, Character>(static_cast<char>(character), ch));
-    }
-    
-    FT_Done_Face(ftFace);
-    FT_Done_FreeType(ftLibrary);
-    
-    mTextRenderingInitialized = true;
-    return true;
+void Renderer::RenderTextCentered(const std::string& text, float posX, float posY, float size, float red, float green, float blue) {
+    mText->AddTextCentered(text, posX, posY, size, BatchColor::FromFloat(red, green, blue));
 }
 
-void Renderer::CleanupTextRendering() {
-    if (!mTextRenderingInitialized) {
-        return;
-    }
-    
-    for (auto& pair : characters) {
-        glDeleteTextures(1, &pair.second.textureID);
-    }
-    characters.clear();
-    
-    mTextRenderingInitialized = false;
+TextId Renderer::InternText(const std::string& text) {
+    return mText->Intern(text);
 }
 
-void Renderer::RenderText(const std::string& text, float posX, float posY, float size, float red, float green, float blue) {
-    if (!mTextRenderingInitialized) {
-        return;
-    }
-    
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-    glEnable(GL_TEXTURE_2D);
-    
-    glColor3f(red, green, blue);
-    
-    constexpr float BASE_SIZE = 48.0F;
-    float scale = size / BASE_SIZE;
-    float currentX = posX;
-    
-    for (char character : text) {
-        Character characterData = characters[character];
-        
-        float xPos = currentX + static_cast<float>(characterData.bearingX) * scale;
-        float yPos = posY - static_cast<float>(characterData.height - characterData.bearingY) * scale;
-        
-        float width = static_cast<float>(characterData.width) * scale;
-        float height = static_cast<float>(characterData.height) * scale;
-        
-        glBindTexture(GL_TEXTURE_2D, characterData.textureID);
-        
-        glBegin(GL_QUADS);
-        glTexCoord2f(0.0F, 0.0F); glVertex2f(xPos, yPos + height);
-        glTexCoord2f(1.0F, 0.0F); glVertex2f(xPos + width, yPos + height);
-        glTexCoord2f(1.0F, 1.0F); glVertex2f(xPos + width, yPos);
-        glTexCoord2f(0.0F, 1.0F); glVertex2f(xPos, yPos);
-        glEnd();
-        
-        constexpr int ADVANCE_SHIFT = 6; // 2^6 = 64
-        currentX += static_cast<float>(characterData.advance >> ADVANCE_SHIFT) * scale;
-    }
-    
-    glDisable(GL_TEXTURE_2D);
-    glDisable(GL_BLEND);
+void Renderer::RenderText(TextId text, float posX, float posY, float size, float red, float green, float blue) {
+    mText->AddText(text, posX, posY, size, BatchColor::FromFloat(red, green, blue));
 }
 
-void Renderer::RenderTextCentered(const std::string& text, float posX, float posY, float size, float red, float green, float blue) {
-    if (!mTextRenderingInitialized) {
-        return;
-    }
-    
-    constexpr float BASE_SIZE = 48.0F;
-    float scale = size / BASE_SIZE;
-    float textWidth = 0.0F;
-    
-    for (char character : text) {
-        Character characterData = characters[character];
-        constexpr int ADVANCE_SHIFT = 6;
-        textWidth += static_cast<float>(characterData.advance >> ADVANCE_SHIFT) * scale;
-    }
-    
-    RenderText(text, posX - textWidth / 2.0F, posY, size, red, green, blue);
+void Renderer::RenderTextCentered(TextId text, float posX, float posY, float size, float red, float green, float blue) {
+    mText->AddTextCentered(text, posX, posY, size, BatchColor::FromFloat(red, green, blue));
 }
 
 void Renderer::RenderTextUI(const std::string& text, int screenX, int screenY, int size, float red, float green, float blue) {
-    if (!mTextRenderingInitialized) {
-        return;
-    }
-    
     constexpr float HALF_DIVISOR = 2.0F;
     float screenWidthHalf = static_cast<float>(mWindowWidth) / HALF_DIVISOR;
     constexpr float OPENGL_HEIGHT_SCALE = 0.75F;
@@ -572,220 +567,115 @@ void Renderer::RenderTextUIYellow(const std::string& text, int screenX, int scre
     RenderTextUI(text, screenX, screenY, size, 1.0F, 1.0F, 0.0F);
 }
 
-void Renderer::DrawGridBorder(float posX, float posY, float size) {
-    // Draw grid border using OpenGL rectangles
-    glColor3f(1.0F, 1.0F, 0.0F); // Yellow border
-    glLineWidth(2.0F);
+void Renderer::SubmitUIList(const UIDrawList& list) {
+    mBatch->Append(list.GetShapes());
+    list.ReplayText(*mText);
+}
+
+void Renderer::DrawGridBorder(UIDrawList& list, float posX, float posY, float size) {
+    static const BatchColor BORDER = BatchColor::FromFloat(1.0F, 1.0F, 0.0F);    // Yellow border
+    static const BatchColor GRID_LINE = BatchColor::FromFloat(0.5F, 0.5F, 0.0F); // Darker yellow for grid
+    BatchRenderer& shapes = list.GetShapes();
     
     // Draw border rectangle
-    glBegin(GL_LINE_LOOP);
-    glVertex2f(posX, posY + size/2);
-    glVertex2f(posX + size, posY + size/2);
-    glVertex2f(posX + size, posY - size/2);
-    glVertex2f(posX, posY - size/2);
-    glEnd();
-    
-    // Draw grid lines
-    glLineWidth(1.0F);
-    glColor3f(0.5F, 0.5F, 0.0F); // Darker yellow for grid
+    shapes.AddRectOutline(posX, posY - size/2, posX + size, posY + size/2, 2.0F, BORDER);
     
-    // Vertical line
-    glBegin(GL_LINES);
-    glVertex2f(posX + size/2, posY + size/2);
-    glVertex2f(posX + size/2, posY - size/2);
-    glEnd();
-    
-    // Horizontal line  
-    glBegin(GL_LINES);
-    glVertex2f(posX, posY);
-    glVertex2f(posX + size, posY);
-    glEnd();
+    // Vertical and horizontal grid lines
+    shapes.AddLine(posX + size/2, posY + size/2, posX + size/2, posY - size/2, 1.0F, GRID_LINE);
+    shapes.AddLine(posX, posY, posX + size, posY, 1.0F, GRID_LINE);
 }
 
-void Renderer::RenderBuildIcon(float posX, float posY, float size, Components::BuildableUnit unitType, int queueCount) {
-    // Draw icon background (filled rectangle)
-    glColor3f(0.3F, 0.3F, 0.3F); // Dark gray background
-    glBegin(GL_QUADS);
-    glVertex2f(posX - size/2, posY + size/2);
-    glVertex2f(posX + size/2, posY + size/2);
-    glVertex2f(posX + size/2, posY - size/2);
-    glVertex2f(posX - size/2, posY - size/2);
-    glEnd();
+void Renderer::RenderBuildIcon(UIDrawList& list, float posX, float posY, float size, Components::BuildableUnit unitType, int queueCount) {
+    static const BatchColor BACKGROUND = BatchColor::FromFloat(0.3F, 0.3F, 0.3F);   // Dark gray background
+    static const BatchColor BORDER = BatchColor::FromFloat(0.6F, 0.6F, 0.6F);       // Light gray border
+    static const BatchColor SHIP_FILL = BatchColor::FromFloat(1.0F, 1.0F, 0.2F);    // Yellow triangle
+    static const BatchColor SHIP_OUTLINE = BatchColor::FromFloat(1.0F, 0.8F, 0.0F); // Darker yellow outline
+    static const BatchColor PLACEHOLDER = BatchColor::FromFloat(0.7F, 0.7F, 0.7F);
+    static const BatchColor QUEUE_COUNT = BatchColor::FromFloat(1.0F, 1.0F, 0.0F);
+    BatchRenderer& shapes = list.GetShapes();
     
-    // Draw icon border
-    glColor3f(0.6F, 0.6F, 0.6F); // Light gray border
-    glLineWidth(2.0F);
-    glBegin(GL_LINE_LOOP);
-    glVertex2f(posX - size/2, posY + size/2);
-    glVertex2f(posX + size/2, posY + size/2);
-    glVertex2f(posX + size/2, posY - size/2);
-    glVertex2f(posX - size/2, posY - size/2);
-    glEnd();
+    // Icon background and border
+    shapes.AddQuad(posX - size/2, posY - size/2, posX + size/2, posY + size/2, BACKGROUND);
+    shapes.AddRectOutline(posX - size/2, posY - size/2, posX + size/2, posY + size/2, 2.0F, BORDER);
     
     // For now, assume unitType 0 = Spacecraft, but we'll make this more generic
     if (unitType == Components::BuildableUnit::Spacecraft) {
-        // Draw triangle icon (like spacecraft) - filled triangle
-        glColor3f(1.0F, 1.0F, 0.2F); // Yellow triangle
-        glBegin(GL_TRIANGLES);
-        glVertex2f(posX, posY + size/3);          // Top point
-        glVertex2f(posX - size/4, posY - size/3); // Bottom left
-        glVertex2f(posX + size/4, posY - size/3); // Bottom right
-        glEnd();
-        
-        // Draw triangle outline
-        glColor3f(1.0F, 0.8F, 0.0F); // Darker yellow outline
-        glLineWidth(1.5F);
-        glBegin(GL_LINE_LOOP);
-        glVertex2f(posX, posY + size/3);
-        glVertex2f(posX - size/4, posY - size/3);
-        glVertex2f(posX + size/4, posY - size/3);
-        glEnd();
+        // Triangle icon (like spacecraft) with outline
+        shapes.AddTriangle(posX, posY + size/3, posX - size/4, posY - size/3, posX + size/4, posY - size/3, SHIP_FILL);
+        shapes.AddTriangleOutline(posX, posY + size/3, posX - size/4, posY - size/3, posX + size/4, posY - size/3, 1.5F, SHIP_OUTLINE);
     } else {
         // Draw question mark or placeholder
-        glColor3f(0.7F, 0.7F, 0.7F);
-        RenderText("?", posX - 0.01F, posY, 0.025F, 0.7F, 0.7F, 0.7F);
+        list.AddText("?", posX - 0.01F, posY, 0.025F, PLACEHOLDER);
     }
     
     // Show queue count if any - positioned lower in the icon
     if (queueCount > 0) {
-        std::string queueText = std::to_string(queueCount);
         constexpr float QUEUE_TEXT_SIZE = 0.05F; // Larger size for better visibility
         // Position text lower and to the right in the icon
-        RenderText(queueText, posX + (size/4), posY - (size/4), QUEUE_TEXT_SIZE, 1.0F, 1.0F, 0.0F);
+        list.AddText(std::to_string(queueCount), posX + (size/4), posY - (size/4), QUEUE_TEXT_SIZE, QUEUE_COUNT);
     }
 }
 
-void Renderer::RenderEmptyIcon(float posX, float posY, float size) {
-    // Draw empty icon slot background
-    glColor3f(0.2F, 0.2F, 0.2F); // Very dark gray background
-    glBegin(GL_QUADS);
-    glVertex2f(posX - size/2, posY + size/2);
-    glVertex2f(posX + size/2, posY + size/2);
-    glVertex2f(posX + size/2, posY - size/2);
-    glVertex2f(posX - size/2, posY - size/2);
-    glEnd();
+void Renderer::RenderEmptyIcon(UIDrawList& list, float posX, float posY, float size) {
+    static const BatchColor BACKGROUND = BatchColor::FromFloat(0.2F, 0.2F, 0.2F); // Very dark gray background
+    static const BatchColor BORDER = BatchColor::FromFloat(0.4F, 0.4F, 0.4F);     // Gray border
+    BatchRenderer& shapes = list.GetShapes();
     
-    // Draw empty icon border (dashed effect using smaller rectangles)
-    glColor3f(0.4F, 0.4F, 0.4F); // Gray border
-    glLineWidth(1.0F);
-    glBegin(GL_LINE_LOOP);
-    glVertex2f(posX - size/2, posY + size/2);
-    glVertex2f(posX + size/2, posY + size/2);
-    glVertex2f(posX + size/2, posY - size/2);
-    glVertex2f(posX - size/2, posY - size/2);
-    glEnd();
+    shapes.AddQuad(posX - size/2, posY - size/2, posX + size/2, posY + size/2, BACKGROUND);
+    shapes.AddRectOutline(posX - size/2, posY - size/2, posX + size/2, posY + size/2, 1.0F, BORDER);
     
     // Draw dash in center to indicate empty slot
-    glColor3f(0.4F, 0.4F, 0.4F);
-    glLineWidth(3.0F);
-    glBegin(GL_LINES);
-    glVertex2f(posX - size/4, posY);
-    glVertex2f(posX + size/4, posY);
-    glEnd();
+    shapes.AddLine(posX - size/4, posY, posX + size/4, posY, 3.0F, BORDER);
 }
 
-void Renderer::RenderUnitSelectionPanel(float posX, float posY, float width, float height) {
-    // Draw panel background
-    glColor4f(0.1F, 0.1F, 0.1F, 0.8F); // Dark background with transparency
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-    glBegin(GL_QUADS);
-    glVertex2f(posX - width/2, posY - height/2);
-    glVertex2f(posX + width/2, posY - height/2);
-    glVertex2f(posX + width/2, posY + height/2);
-    glVertex2f(posX - width/2, posY + height/2);
-    glEnd();
-    glDisable(GL_BLEND);
+void Renderer::RenderUnitSelectionPanel(UIDrawList& list, float posX, float posY, float width, float height) {
+    static const BatchColor BACKGROUND = BatchColor::FromFloat(0.1F, 0.1F, 0.1F, 0.8F); // Dark background with transparency
+    static const BatchColor BORDER = BatchColor::FromFloat(0.6F, 0.6F, 0.6F);           // Light gray border
+    BatchRenderer& shapes = list.GetShapes();
     
-    // Draw panel border
-    glColor3f(0.6F, 0.6F, 0.6F); // Light gray border
-    glLineWidth(2.0F);
-    glBegin(GL_LINE_LOOP);
-    glVertex2f(posX - width/2, posY - height/2);
-    glVertex2f(posX + width/2, posY - height/2);
-    glVertex2f(posX + width/2, posY + height/2);
-    glVertex2f(posX - width/2, posY + height/2);
-    glEnd();
+    shapes.AddQuad(posX - width/2, posY - height/2, posX + width/2, posY + height/2, BACKGROUND);
+    shapes.AddRectOutline(posX - width/2, posY - height/2, posX + width/2, posY + height/2, 2.0F, BORDER);
 }
 
-void Renderer::RenderSelectedUnitIcon(float posX, float posY, float size, Components::SpacecraftType unitType, int count, float healthPercent) {
-    // Draw icon background
-    glColor3f(0.2F, 0.2F, 0.2F); // Dark gray background
-    glBegin(GL_QUADS);
-    glVertex2f(posX - size/2, posY + size/2);
-    glVertex2f(posX + size/2, posY + size/2);
-    glVertex2f(posX + size/2, posY - size/2);
-    glVertex2f(posX - size/2, posY - size/2);
-    glEnd();
+void Renderer::RenderSelectedUnitIcon(UIDrawList& list, float posX, float posY, float size, Components::SpacecraftType unitType, int count, float healthPercent) {
+    static const BatchColor BACKGROUND = BatchColor::FromFloat(0.2F, 0.2F, 0.2F);     // Dark gray background
+    static const BatchColor BORDER = BatchColor::FromFloat(0.5F, 0.5F, 0.5F);         // Gray border
+    static const BatchColor PLAYER_FILL = BatchColor::FromFloat(1.0F, 0.8F, 0.2F);    // Yellow triangle
+    static const BatchColor PLAYER_OUTLINE = BatchColor::FromFloat(1.0F, 0.6F, 0.0F); // Darker yellow outline
+    static const BatchColor ENEMY_FILL = BatchColor::FromFloat(1.0F, 0.2F, 0.2F);     // Red triangle
+    static const BatchColor HEALTH_BACKGROUND = BatchColor::FromFloat(0.3F, 0.3F, 0.3F);
+    static const BatchColor COUNT_COLOR = BatchColor::FromFloat(1.0F, 1.0F, 0.0F);
+    BatchRenderer& shapes = list.GetShapes();
     
-    // Draw icon border
-    glColor3f(0.5F, 0.5F, 0.5F); // Gray border
-    glLineWidth(1.5F);
-    glBegin(GL_LINE_LOOP);
-    glVertex2f(posX - size/2, posY + size/2);
-    glVertex2f(posX + size/2, posY + size/2);
-    glVertex2f(posX + size/2, posY - size/2);
-    glVertex2f(posX - size/2, posY - size/2);
-    glEnd();
+    // Icon background and border
+    shapes.AddQuad(posX - size/2, posY - size/2, posX + size/2, posY + size/2, BACKGROUND);
+    shapes.AddRectOutline(posX - size/2, posY - size/2, posX + size/2, posY + size/2, 1.5F, BORDER);
     
     // Draw unit icon based on type
     if (unitType == Components::SpacecraftType::Player) {
-        // Draw triangle icon (like spacecraft) - filled triangle
-        glColor3f(1.0F, 0.8F, 0.2F); // Yellow triangle
-        glBegin(GL_TRIANGLES);
-        glVertex2f(posX, posY + size/3);          // Top point
-        glVertex2f(posX - size/4, posY - size/3); // Bottom left
-        glVertex2f(posX + size/4, posY - size/3); // Bottom right
-        glEnd();
-        
-        // Draw triangle outline
-        glColor3f(1.0F, 0.6F, 0.0F); // Darker yellow outline
-        glLineWidth(1.0F);
-        glBegin(GL_LINE_LOOP);
-        glVertex2f(posX, posY + size/3);
-        glVertex2f(posX - size/4, posY - size/3);
-        glVertex2f(posX + size/4, posY - size/3);
-        glEnd();
+        shapes.AddTriangle(posX, posY + size/3, posX - size/4, posY - size/3, posX + size/4, posY - size/3, PLAYER_FILL);
+        shapes.AddTriangleOutline(posX, posY + size/3, posX - size/4, posY - size/3, posX + size/4, posY - size/3, 1.0F, PLAYER_OUTLINE);
     } else if (unitType == Components::SpacecraftType::Enemy) {
         // Draw different icon for enemy units
-        glColor3f(1.0F, 0.2F, 0.2F); // Red triangle
-        glBegin(GL_TRIANGLES);
-        glVertex2f(posX, posY + size/3);
-        glVertex2f(posX - size/4, posY - size/3);
-        glVertex2f(posX + size/4, posY - size/3);
-        glEnd();
+        shapes.AddTriangle(posX, posY + size/3, posX - size/4, posY - size/3, posX + size/4, posY - size/3, ENEMY_FILL);
     }
     
     // Draw health bar below the icon
     float healthBarWidth = size * 0.8F;
     float healthBarHeight = size * 0.1F;
     float healthBarY = posY - size/2 - healthBarHeight - 0.01F;
+    float healthBarLeft = posX - healthBarWidth/2;
+    shapes.AddQuad(healthBarLeft, healthBarY, healthBarLeft + healthBarWidth, healthBarY + healthBarHeight, HEALTH_BACKGROUND);
     
-    // Health bar background
-    glColor3f(0.3F, 0.3F, 0.3F);
-    glBegin(GL_QUADS);
-    glVertex2f(posX - healthBarWidth/2, healthBarY);
-    glVertex2f(posX + healthBarWidth/2, healthBarY);
-    glVertex2f(posX + healthBarWidth/2, healthBarY + healthBarHeight);
-    glVertex2f(posX - healthBarWidth/2, healthBarY + healthBarHeight);
-    glEnd();
-    
-    // Health bar fill
+    // Health bar fill shades from red to green
     float healthColor = healthPercent > 0.5F ? 0.2F + (healthPercent - 0.5F) : 0.2F;
-    glColor3f(1.0F - healthPercent + 0.2F, healthColor + healthPercent * 0.8F, 0.2F);
-    float actualWidth = healthBarWidth * healthPercent;
-    glBegin(GL_QUADS);
-    glVertex2f(posX - healthBarWidth/2, healthBarY);
-    glVertex2f(posX - healthBarWidth/2 + actualWidth, healthBarY);
-    glVertex2f(posX - healthBarWidth/2 + actualWidth, healthBarY + healthBarHeight);
-    glVertex2f(posX - healthBarWidth/2, healthBarY + healthBarHeight);
-    glEnd();
+    BatchColor fill = BatchColor::FromFloat(1.0F - healthPercent + 0.2F, healthColor + healthPercent * 0.8F, 0.2F);
+    shapes.AddQuad(healthBarLeft, healthBarY, healthBarLeft + (healthBarWidth * healthPercent), healthBarY + healthBarHeight, fill);
     
     // Show count if more than 1
     if (count > 1) {
-        std::string countText = std::to_string(count);
         constexpr float COUNT_TEXT_SIZE = 0.03F;
         // Position count in bottom-right corner of icon
-        RenderText(countText, posX + size/3, posY - size/3, COUNT_TEXT_SIZE, 1.0F, 1.0F, 0.0F);
+        list.AddText(std::to_string(count), posX + size/3, posY - size/3, COUNT_TEXT_SIZE, COUNT_COLOR);
     }
 }
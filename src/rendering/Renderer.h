@@ -2,7 +2,18 @@
 
 #include "../core/ECSRegistry.h"
 #include "../components/Components.h"
+#include "Camera.h"
+#include "RenderSnapshot.h"
+#include "TextRenderer.h"
+#include <array>
+#include <memory>
 #include <string>
+#include <vector>
+
+class BatchRenderer;
+class ProjectilePool;
+class SpatialIndexSystem;
+class UIDrawList;
 
 /**
  * @brief Professional renderer using modern OpenGL practices
@@ -19,6 +30,14 @@ public:
     bool Initialize(int windowWidth, int windowHeight);
     void Shutdown();
 
+    /**
+     * @brief Copy visible world state into the back snapshot and publish it
+     *
+     * Call once the simulation step is complete. RenderWorld only draws
+     * published snapshots, so it never reads the registry.
+     */
+    void ExtractSnapshot();
+
     // Rendering interface
     void BeginFrame();
     void RenderWorld();
@@ -36,55 +55,115 @@ public:
     void RenderTextUI(const std::string& text, int screenX, int screenY, int size,
                      float red = 1.0F, float green = 1.0F, float blue = 1.0F);
 
+    // Static labels: intern once, then draw by id without touching strings
+    TextId InternText(const std::string& text);
+    void RenderText(TextId text, float posX, float posY, float size,
+                   float red = 1.0F, float green = 1.0F, float blue = 1.0F);
+    void RenderTextCentered(TextId text, float posX, float posY, float size,
+                           float red = 1.0F, float green = 1.0F, float blue = 1.0F);
+
     // Convenience text rendering functions
     void RenderTextUIWhite(const std::string& text, int screenX, int screenY, int size);
     void RenderTextUIGreen(const std::string& text, int screenX, int screenY, int size);
     void RenderTextUIRed(const std::string& text, int screenX, int screenY, int size);
     void RenderTextUIYellow(const std::string& text, int screenX, int screenY, int size);
 
+    // Set pool of in-flight projectiles to draw
+    void SetProjectilePool(ProjectilePool* projectilePool) { mProjectilePool = projectilePool; }
+
+    // Set spatial index used to cull entities outside the camera view
+    void SetSpatialIndex(SpatialIndexSystem* spatialIndex) { mSpatialIndex = spatialIndex; }
+
+    // World view; the UI is always drawn in fixed screen space
+    Camera& GetCamera() { return mCamera; }
+    const Camera& GetCamera() const { return mCamera; }
+
     // Selection box interface
     void SetDragSelectionBox(int startX, int startY, int endX, int endY, bool active);
 
-    // UI rendering interface
-    void DrawGridBorder(float posX, float posY, float size);
-    void RenderBuildIcon(float posX, float posY, float size, Components::BuildableUnit unitType, int queueCount);
-    void RenderEmptyIcon(float posX, float posY, float size);
+    // UI rendering interface; widgets are recorded into a retained list
+    void DrawGridBorder(UIDrawList& list, float posX, float posY, float size);
+    void RenderBuildIcon(UIDrawList& list, float posX, float posY, float size, Components::BuildableUnit unitType, int queueCount);
+    void RenderEmptyIcon(UIDrawList& list, float posX, float posY, float size);
     
     // Unit selection panel
-    void RenderUnitSelectionPanel(float posX, float posY, float width, float height);
-    void RenderSelectedUnitIcon(float posX, float posY, float size, Components::SpacecraftType unitType, int count, float healthPercent);
+    void RenderUnitSelectionPanel(UIDrawList& list, float posX, float posY, float width, float height);
+    void RenderSelectedUnitIcon(UIDrawList& list, float posX, float posY, float size, Components::SpacecraftType unitType, int count, float healthPercent);
+
+    /**
+     * @brief Queue a recorded UI panel; it is drawn by RenderUI
+     */
+    void SubmitUIList(const UIDrawList& list);
 
 private:
-    // Helper functions
-    std::string GetAIStateString(Components::AIState state) const;
-    
+    /**
+     * @brief How much per-ship detail to draw this frame
+     *
+     * Full draws hull, health bar and labels. Dots draws each ship as a
+     * few-pixel square. Density replaces ships with one shaded quad per
+     * screen cell, so geometry stays bounded however many units are in view.
+     */
+    enum class DetailLevel : std::uint8_t {
+        Full,
+        Dots,
+        Density
+    };
+
+    // Enemy AI state label and the color it is drawn in
+    struct AIStateLabel {
+        TextId text;
+        BatchColor color;
+    };
+
     // Core rendering
     void SetupOpenGL();
-    void RenderSpacecraft();
-    void RenderPlanets();
-    void RenderProjectiles();
-    void RenderSelectionBoxes();
-    void RenderDragSelectionBox();
-    
-    // Primitive rendering
-    void DrawCircle(float centerX, float centerY, float radius);
-    void DrawTriangle(float posX, float posY, float angle);
-    void DrawHealthBar(float posX, float posY, float width, float height, float healthPercent);
-
-    // Text rendering system
-    bool InitializeTextRendering();
-    void CleanupTextRendering();
+    void ApplyWorldProjection(const Camera& camera);
+    void ApplyScreenProjection();
+    void CollectVisibleEntities();
+    DetailLevel SelectDetailLevel(const RenderSnapshot& snapshot) const;
+    void RenderSpacecraft(const RenderSnapshot& snapshot);
+    void RenderSpacecraftDots(const RenderSnapshot& snapshot);
+    void RenderSpacecraftDensity(const RenderSnapshot& snapshot);
+    void RenderSpacecraftLabels(const RenderSnapshot& snapshot);
+    void RenderPlanets(const RenderSnapshot& snapshot);
+    void RenderProjectiles(const RenderSnapshot& snapshot);
+    void RenderSelectionBoxes(const RenderSnapshot& snapshot);
+    void RenderDragSelectionBox(const RenderSnapshot& snapshot);
 
     // ECS registry reference
     ECSRegistry& mRegistry;
 
+    // Projectile storage
+    ProjectilePool* mProjectilePool = nullptr;
+
+    // View and culling, used while extracting
+    Camera mCamera;
+    SpatialIndexSystem* mSpatialIndex = nullptr;
+    std::vector<EntityID> mVisibleShips;
+    std::vector<EntityID> mVisiblePlanets;
+
+    // Extracted draw data: simulation writes one, the world pass draws the other
+    RenderSnapshotBuffer mSnapshots;
+    DetailLevel mDetailLevel = DetailLevel::Full;
+
+    // Per-cell ship counts for density rendering, reused every frame
+    std::vector<std::uint16_t> mDensityPlayer;
+    std::vector<std::uint16_t> mDensityEnemy;
+
+    // World geometry batching
+    std::unique_ptr<BatchRenderer> mBatch;
+
+    // Glyph atlas text batching
+    std::unique_ptr<TextRenderer> mText;
+
+    // Indexed by Components::AIState
+    static constexpr std::size_t AI_STATE_COUNT = 5;
+    std::array<AIStateLabel, AI_STATE_COUNT> mAIStateLabels;
+
     // Window properties
     int mWindowWidth;
     int mWindowHeight;
     
-    // OpenGL state
-    bool mTextRenderingInitialized;
-    
     // Drag selection box state
     bool mDragSelectionActive = false;
     int mDragStartX = 0; 
@@ -95,5 +174,17 @@ private:
     // Rendering constants
     static constexpr float WORLD_ASPECT_RATIO = 0.75F;
     static constexpr float TRIANGLE_SIZE = 0.03F;
-    static constexpr int CIRCLE_SEGMENTS = 32;
+    static constexpr float PROJECTILE_RADIUS = 0.012F;
+    static constexpr float SHIP_CULL_MARGIN = 0.1F;   // Hull, health bar and state label
+    static constexpr float PLANET_CULL_MARGIN = 0.25F; // Largest planet plus its health bar
+    
+    // Level of detail thresholds
+    static constexpr float FULL_DETAIL_MIN_PIXELS = 8.0F;    // On-screen ship size needed for full detail
+    static constexpr float DOTS_MIN_PIXELS = 3.0F;           // Below this, ships are binned into density cells
+    static constexpr std::size_t FULL_DETAIL_MAX_SHIPS = 400;
+    static constexpr std::size_t DOTS_MAX_SHIPS = 4000;
+    static constexpr float DOT_PIXELS = 3.0F;
+    static constexpr int DENSITY_COLUMNS = 64;
+    static constexpr int DENSITY_ROWS = 48;
+    static constexpr float DENSITY_SATURATION = 8.0F;        // Ships per cell drawn fully opaque
 };
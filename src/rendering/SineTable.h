@@ -0,0 +1,40 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+/**
+ * @brief One cycle of a sine wave, read by phase with linear interpolation
+ *
+ * Shared by every oscillator in the audio code; phases are kept in cycles
+ * rather than radians so wrapping is a single subtraction.
+ */
+class SineTable {
+public:
+    SineTable() {
+        constexpr double TWO_PI = 6.283185307179586;
+        for (std::size_t i = 0; i <= SIZE; ++i) {
+            mValues[i] = static_cast<float>(std::sin(TWO_PI * static_cast<double>(i) / static_cast<double>(SIZE)));
+        }
+    }
+
+    // phase in cycles, [0, 1)
+    float operator()(float phase) const {
+        float position = phase * static_cast<float>(SIZE);
+        auto index = static_cast<std::size_t>(position);
+        float fraction = position - static_cast<float>(index);
+        return mValues[index] + (fraction * (mValues[index + 1] - mValues[index]));
+    }
+
+private:
+    static constexpr std::size_t SIZE = 2048;
+    std::array<float, SIZE + 1> mValues{}; // Last entry repeats the first so index + 1 is always valid
+};
+
+inline const SineTable SINE;
+
+// Advance past the end of a cycle by less than one cycle
+inline float WrapPhase(float phase) {
+    return phase >= 1.0F ? phase - 1.0F : phase;
+}
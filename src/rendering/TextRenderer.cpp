@@ -0,0 +1,331 @@
+#include "TextRenderer.h"
+#include <GL/gl.h>
+#include <SDL_log.h>
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <iostream>
+
+// FreeType includes
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+namespace {
+    // Glyph bitmap held between rasterizing and packing into the atlas
+    struct GlyphBitmap {
+        int width = 0;
+        int height = 0;
+        int atlasX = 0;
+        int atlasY = 0;
+        std::vector<std::uint8_t> pixels;
+    };
+
+    int NextPowerOfTwo(int value) {
+        int result = 1;
+        while (result < value) {
+            result <<= 1;
+        }
+        return result;
+    }
+}
+
+TextRenderer::TextRenderer()
+    : mGlyphs()
+    , mAtlasTexture(0)
+    , mVertices()
+    , mLayoutCache()
+    , mInternedText()
+    , mInternedIds()
+    , mSizedLayouts()
+{
+}
+
+TextRenderer::~TextRenderer() {
+    Shutdown();
+}
+
+bool TextRenderer::Initialize() {
+    if (IsInitialized()) {
+        return true;
+    }
+
+    // Initialize FreeType
+    FT_Library ftLibrary = nullptr;
+    if (FT_Init_FreeType(&ftLibrary) != 0) {
+        std::cerr << "ERROR::FREETYPE: Could not init FreeType Library\n";
+        return false;
+    }
+
+    // Try to load a font
+    const char* fontPaths[] = {
+        "/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf",
+        "/usr/share/fonts/TTF/DejaVuSans.ttf",
+        "/System/Library/Fonts/Arial.ttf",
+        "/Windows/Fonts/arial.ttf",
+        "/usr/share/fonts/truetype/liberation/LiberationSans-Regular.ttf"
+    };
+
+    FT_Face ftFace = nullptr;
+    bool fontLoaded = false;
+    for (const char* fontPath : fontPaths) {
+        if (FT_New_Face(ftLibrary, fontPath, 0, &ftFace) == 0) {
+            fontLoaded = true;
+            break;
+        }
+    }
+
+    if (!fontLoaded) {
+        std::cerr << "ERROR::FREETYPE: Failed to load any font\n";
+        FT_Done_FreeType(ftLibrary);
+        return false;
+    }
+
+    FT_Set_Pixel_Sizes(ftFace, 0, FONT_SIZE);
+
+    // Rasterize every glyph and pack it onto shelves
+    std::vector<GlyphBitmap> bitmaps(GLYPH_COUNT);
+    int shelfX = GLYPH_PADDING;
+    int shelfY = GLYPH_PADDING;
+    int shelfHeight = 0;
+
+    for (int character = 0; character < GLYPH_COUNT; ++character) {
+        if (FT_Load_Char(ftFace, static_cast<FT_ULong>(character), FT_LOAD_RENDER) != 0) {
+            std::cerr << "ERROR::FREETYPE: Failed to load Glyph " << character << '\n';
+            continue;
+        }
+
+        const FT_GlyphSlot slot = ftFace->glyph;
+        GlyphBitmap& bitmap = bitmaps[character];
+        bitmap.width = static_cast<int>(slot->bitmap.width);
+        bitmap.height = static_cast<int>(slot->bitmap.rows);
+        bitmap.pixels.resize(static_cast<std::size_t>(bitmap.width) * static_cast<std::size_t>(bitmap.height));
+        for (int row = 0; row < bitmap.height; ++row) {
+            std::copy_n(slot->bitmap.buffer + (row * slot->bitmap.pitch), bitmap.width,
+                        bitmap.pixels.begin() + (static_cast<std::ptrdiff_t>(row) * bitmap.width));
+        }
+
+        if (shelfX + bitmap.width + GLYPH_PADDING > ATLAS_WIDTH) {
+            shelfX = GLYPH_PADDING;
+            shelfY += shelfHeight + GLYPH_PADDING;
+            shelfHeight = 0;
+        }
+        bitmap.atlasX = shelfX;
+        bitmap.atlasY = shelfY;
+        shelfX += bitmap.width + GLYPH_PADDING;
+        shelfHeight = std::max(shelfHeight, bitmap.height);
+
+        Glyph& glyph = mGlyphs[character];
+        glyph.width = bitmap.width;
+        glyph.height = bitmap.height;
+        glyph.bearingX = slot->bitmap_left;
+        glyph.bearingY = slot->bitmap_top;
+        constexpr int ADVANCE_SHIFT = 6; // 26.6 fixed point
+        glyph.advance = static_cast<int>(slot->advance.x >> ADVANCE_SHIFT);
+    }
+
+    FT_Done_Face(ftFace);
+    FT_Done_FreeType(ftLibrary);
+
+    // Copy the packed glyphs into a single alpha texture
+    int atlasHeight = NextPowerOfTwo(shelfY + shelfHeight + GLYPH_PADDING);
+    std::vector<std::uint8_t> atlas(static_cast<std::size_t>(ATLAS_WIDTH) * static_cast<std::size_t>(atlasHeight), 0);
+    for (int character = 0; character < GLYPH_COUNT; ++character) {
+        const GlyphBitmap& bitmap = bitmaps[character];
+        for (int row = 0; row < bitmap.height; ++row) {
+            std::copy_n(bitmap.pixels.begin() + (static_cast<std::ptrdiff_t>(row) * bitmap.width), bitmap.width,
+                        atlas.begin() + (static_cast<std::ptrdiff_t>(bitmap.atlasY + row) * ATLAS_WIDTH) + bitmap.atlasX);
+        }
+
+        Glyph& glyph = mGlyphs[character];
+        glyph.u0 = static_cast<float>(bitmap.atlasX) / static_cast<float>(ATLAS_WIDTH);
+        glyph.v0 = static_cast<float>(bitmap.atlasY) / static_cast<float>(atlasHeight);
+        glyph.u1 = static_cast<float>(bitmap.atlasX + bitmap.width) / static_cast<float>(ATLAS_WIDTH);
+        glyph.v1 = static_cast<float>(bitmap.atlasY + bitmap.height) / static_cast<float>(atlasHeight);
+    }
+
+    // Coverage goes in alpha so glColor supplies the text color
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glGenTextures(1, &mAtlasTexture);
+    glBindTexture(GL_TEXTURE_2D, mAtlasTexture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_ALPHA, ATLAS_WIDTH, atlasHeight, 0, GL_ALPHA, GL_UNSIGNED_BYTE, atlas.data());
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    SDL_Log("Glyph atlas built (%dx%d)", ATLAS_WIDTH, atlasHeight);
+    return true;
+}
+
+void TextRenderer::Shutdown() {
+    if (mAtlasTexture != 0) {
+        glDeleteTextures(1, &mAtlasTexture);
+        mAtlasTexture = 0;
+    }
+    mVertices.clear();
+    mLayoutCache.clear();
+    mSizedLayouts.clear();
+}
+
+TextId TextRenderer::Intern(const std::string& text) {
+    auto iterator = mInternedIds.find(text);
+    if (iterator != mInternedIds.end()) {
+        return iterator->second;
+    }
+
+    mInternedText.push_back(text);
+    auto textId = static_cast<TextId>(mInternedText.size());
+    mInternedIds.emplace(text, textId);
+    return textId;
+}
+
+void TextRenderer::AddText(const std::string& text, float posX, float posY, float size, BatchColor color) {
+    if (!IsInitialized()) {
+        return;
+    }
+
+    AppendLayout(GetLayout(text), posX, posY, size / static_cast<float>(FONT_SIZE), color);
+}
+
+void TextRenderer::AddTextCentered(const std::string& text, float posX, float posY, float size, BatchColor color) {
+    if (!IsInitialized()) {
+        return;
+    }
+
+    const TextLayout& layout = GetLayout(text);
+    float scale = size / static_cast<float>(FONT_SIZE);
+    AppendLayout(layout, posX - (layout.width * scale / 2.0F), posY, scale, color);
+}
+
+float TextRenderer::MeasureText(const std::string& text, float size) {
+    if (!IsInitialized()) {
+        return 0.0F;
+    }
+
+    return GetLayout(text).width * size / static_cast<float>(FONT_SIZE);
+}
+
+void TextRenderer::AddText(TextId text, float posX, float posY, float size, BatchColor color) {
+    const TextLayout* layout = GetLayout(text, size);
+    if (layout != nullptr) {
+        AppendLayout(*layout, posX, posY, 1.0F, color);
+    }
+}
+
+void TextRenderer::AddTextCentered(TextId text, float posX, float posY, float size, BatchColor color) {
+    const TextLayout* layout = GetLayout(text, size);
+    if (layout != nullptr) {
+        AppendLayout(*layout, posX - (layout->width / 2.0F), posY, 1.0F, color);
+    }
+}
+
+float TextRenderer::MeasureText(TextId text, float size) {
+    const TextLayout* layout = GetLayout(text, size);
+    return layout != nullptr ? layout->width : 0.0F;
+}
+
+void TextRenderer::Flush() {
+    if (mVertices.empty()) {
+        return;
+    }
+
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glEnable(GL_TEXTURE_2D);
+    glBindTexture(GL_TEXTURE_2D, mAtlasTexture);
+    glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
+
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+    glEnableClientState(GL_COLOR_ARRAY);
+    glVertexPointer(2, GL_FLOAT, sizeof(Vertex), &mVertices.front().posX);
+    glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), &mVertices.front().texU);
+    glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), &mVertices.front().color);
+
+    glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(mVertices.size()));
+
+    glDisableClientState(GL_COLOR_ARRAY);
+    glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+    glDisableClientState(GL_VERTEX_ARRAY);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glDisable(GL_TEXTURE_2D);
+    glDisable(GL_BLEND);
+
+    mVertices.clear();
+}
+
+const TextRenderer::TextLayout& TextRenderer::GetLayout(const std::string& text) {
+    auto iterator = mLayoutCache.find(text);
+    if (iterator != mLayoutCache.end()) {
+        return iterator->second;
+    }
+
+    // Strings that change every frame would otherwise grow the cache forever
+    if (mLayoutCache.size() >= MAX_CACHED_LAYOUTS) {
+        mLayoutCache.clear();
+    }
+
+    return mLayoutCache.emplace(text, BuildLayout(text, 1.0F)).first->second;
+}
+
+const TextRenderer::TextLayout* TextRenderer::GetLayout(TextId text, float size) {
+    if (!IsInitialized() || text == INVALID_TEXT || text > mInternedText.size()) {
+        return nullptr;
+    }
+
+    constexpr int ID_SHIFT = 32;
+    std::uint64_t key = (static_cast<std::uint64_t>(text) << ID_SHIFT) | std::bit_cast<std::uint32_t>(size);
+    auto iterator = mSizedLayouts.find(key);
+    if (iterator != mSizedLayouts.end()) {
+        return &iterator->second;
+    }
+
+    // Labels are a fixed set drawn at a handful of sizes, so this stays small
+    TextLayout layout = BuildLayout(mInternedText[text - 1], size / static_cast<float>(FONT_SIZE));
+    return &mSizedLayouts.emplace(key, std::move(layout)).first->second;
+}
+
+TextRenderer::TextLayout TextRenderer::BuildLayout(const std::string& text, float scale) const {
+    TextLayout layout;
+    layout.quads.reserve(text.size());
+    float penX = 0.0F;
+    for (char character : text) {
+        auto index = static_cast<unsigned char>(character);
+        if (index >= GLYPH_COUNT) {
+            continue;
+        }
+
+        const Glyph& glyph = mGlyphs[index];
+        if (glyph.width > 0 && glyph.height > 0) {
+            float minX = penX + static_cast<float>(glyph.bearingX);
+            float minY = -static_cast<float>(glyph.height - glyph.bearingY);
+            layout.quads.push_back({
+                minX * scale, minY * scale,
+                (minX + static_cast<float>(glyph.width)) * scale, (minY + static_cast<float>(glyph.height)) * scale,
+                glyph.u0, glyph.v0, glyph.u1, glyph.v1
+            });
+        }
+        penX += static_cast<float>(glyph.advance);
+    }
+    layout.width = penX * scale;
+
+    return layout;
+}
+
+void TextRenderer::AppendLayout(const TextLayout& layout, float posX, float posY, float scale, BatchColor color) {
+    for (const GlyphQuad& quad : layout.quads) {
+        float minX = posX + (quad.minX * scale);
+        float minY = posY + (quad.minY * scale);
+        float maxX = posX + (quad.maxX * scale);
+        float maxY = posY + (quad.maxY * scale);
+
+        // Bitmap rows run top to bottom, so the top edge samples v0
+        mVertices.push_back({minX, maxY, quad.u0, quad.v0, color});
+        mVertices.push_back({maxX, maxY, quad.u1, quad.v0, color});
+        mVertices.push_back({maxX, minY, quad.u1, quad.v1, color});
+        mVertices.push_back({minX, maxY, quad.u0, quad.v0, color});
+        mVertices.push_back({maxX, minY, quad.u1, quad.v1, color});
+        mVertices.push_back({minX, minY, quad.u0, quad.v1, color});
+    }
+}
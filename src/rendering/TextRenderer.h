@@ -0,0 +1,139 @@
+#pragma once
+
+#include "BatchRenderer.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Handle to a string interned with TextRenderer::Intern
+ */
+using TextId = std::uint32_t;
+
+/**
+ * @brief Glyph atlas text rendering with batched quads
+ *
+ * All ASCII glyphs are rasterized once into a single alpha texture. Text is
+ * queued as textured quads and submitted with one draw call per Flush.
+ * Static labels are interned once and their layouts cached per (id, size)
+ * with quads already scaled, so drawing them is a cache hit and a copy into
+ * the vertex queue. Free-form strings fall back to a bounded cache of
+ * unit-scale layouts keyed by the string itself.
+ */
+class TextRenderer {
+public:
+    TextRenderer();
+    ~TextRenderer();
+
+    // Non-copyable, owns the atlas texture
+    TextRenderer(const TextRenderer&) = delete;
+    TextRenderer& operator=(const TextRenderer&) = delete;
+
+    /**
+     * @brief Load the font and build the glyph atlas; requires a current GL context
+     * @return false if no font could be loaded
+     */
+    bool Initialize();
+    void Shutdown();
+    bool IsInitialized() const { return mAtlasTexture != 0; }
+
+    /**
+     * @brief Register a label and return its stable id; equal strings share an id
+     *
+     * Ids stay valid across Shutdown/Initialize, so labels can be interned
+     * before the atlas exists.
+     */
+    TextId Intern(const std::string& text);
+
+    static constexpr TextId INVALID_TEXT = 0;
+
+    /**
+     * @brief Queue text with its baseline starting at (posX, posY)
+     * @param size Height of the font's em square in world units
+     */
+    void AddText(const std::string& text, float posX, float posY, float size, BatchColor color);
+
+    /**
+     * @brief Queue text horizontally centered on posX
+     */
+    void AddTextCentered(const std::string& text, float posX, float posY, float size, BatchColor color);
+
+    /**
+     * @brief Width of text at the given size
+     */
+    float MeasureText(const std::string& text, float size);
+
+    // Interned label variants, served from the (id, size) layout cache
+    void AddText(TextId text, float posX, float posY, float size, BatchColor color);
+    void AddTextCentered(TextId text, float posX, float posY, float size, BatchColor color);
+    float MeasureText(TextId text, float size);
+
+    /**
+     * @brief Draw all queued text in one call and clear the queue
+     */
+    void Flush();
+
+private:
+    struct Glyph {
+        float u0 = 0.0F;
+        float v0 = 0.0F;
+        float u1 = 0.0F;
+        float v1 = 0.0F;
+        int width = 0;
+        int height = 0;
+        int bearingX = 0;
+        int bearingY = 0;
+        int advance = 0; // In pixels
+    };
+
+    // Glyph quad relative to the text origin, in font pixels times the layout scale
+    struct GlyphQuad {
+        float minX;
+        float minY;
+        float maxX;
+        float maxY;
+        float u0;
+        float v0;
+        float u1;
+        float v1;
+    };
+
+    struct TextLayout {
+        std::vector<GlyphQuad> quads;
+        float width = 0.0F; // Same scale as the quads
+    };
+
+    struct Vertex {
+        float posX;
+        float posY;
+        float texU;
+        float texV;
+        BatchColor color;
+    };
+
+    const TextLayout& GetLayout(const std::string& text);
+    const TextLayout* GetLayout(TextId text, float size);
+    TextLayout BuildLayout(const std::string& text, float scale) const;
+    void AppendLayout(const TextLayout& layout, float posX, float posY, float scale, BatchColor color);
+
+    static constexpr int GLYPH_COUNT = 128;
+    static constexpr unsigned int FONT_SIZE = 48;
+    static constexpr int ATLAS_WIDTH = 1024;
+    static constexpr int GLYPH_PADDING = 1;
+    static constexpr std::size_t MAX_CACHED_LAYOUTS = 1024;
+
+    std::array<Glyph, GLYPH_COUNT> mGlyphs;
+    unsigned int mAtlasTexture;
+    std::vector<Vertex> mVertices;
+    std::unordered_map<std::string, TextLayout> mLayoutCache;
+
+    // Interned labels; id N is stored at index N - 1
+    std::vector<std::string> mInternedText;
+    std::unordered_map<std::string, TextId> mInternedIds;
+
+    // Layouts of interned labels keyed by id in the high word and size bits in the low word
+    std::unordered_map<std::uint64_t, TextLayout> mSizedLayouts;
+};
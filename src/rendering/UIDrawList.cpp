@@ -0,0 +1,24 @@
+#include "UIDrawList.h"
+
+void UIDrawList::Clear() {
+    mShapes.Begin();
+    mText.clear();
+}
+
+void UIDrawList::AddText(TextId text, float posX, float posY, float size, BatchColor color) {
+    mText.push_back({text, std::string(), posX, posY, size, color});
+}
+
+void UIDrawList::AddText(const std::string& text, float posX, float posY, float size, BatchColor color) {
+    mText.push_back({TextRenderer::INVALID_TEXT, text, posX, posY, size, color});
+}
+
+void UIDrawList::ReplayText(TextRenderer& textRenderer) const {
+    for (const auto& command : mText) {
+        if (command.label != TextRenderer::INVALID_TEXT) {
+            textRenderer.AddText(command.label, command.posX, command.posY, command.size, command.color);
+        } else {
+            textRenderer.AddText(command.text, command.posX, command.posY, command.size, command.color);
+        }
+    }
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "BatchRenderer.h"
+#include "TextRenderer.h"
+#include <string>
+#include <vector>
+
+/**
+ * @brief Retained geometry and text for one screen-space UI panel
+ *
+ * A panel records its shapes and labels once, when something it shows
+ * changes, and Renderer::SubmitUIList replays the recording every frame by
+ * appending it to the shared batches. Recording needs no GL context.
+ */
+class UIDrawList {
+public:
+    /**
+     * @brief Discard the recording, keeping allocated storage
+     */
+    void Clear();
+
+    BatchRenderer& GetShapes() { return mShapes; }
+    const BatchRenderer& GetShapes() const { return mShapes; }
+
+    void AddText(TextId text, float posX, float posY, float size, BatchColor color);
+    void AddText(const std::string& text, float posX, float posY, float size, BatchColor color);
+
+    /**
+     * @brief Queue the recorded labels for drawing
+     */
+    void ReplayText(TextRenderer& textRenderer) const;
+
+private:
+    // Interned labels are replayed by id; free-form text keeps its own copy
+    struct TextCommand {
+        TextId label;
+        std::string text;
+        float posX;
+        float posY;
+        float size;
+        BatchColor color;
+    };
+
+    BatchRenderer mShapes;
+    std::vector<TextCommand> mText;
+};
@@ -1,6 +1,7 @@
 #include "CollisionSystem.h"
 #include "../components/Components.h"
-#include "../rendering/AudioManager.h"
+#include "../core/EventBus.h"
+#include "../core/ProjectilePool.h"
 #include <SDL2/SDL_log.h>
 #include <cmath>
 #include <vector>
@@ -8,7 +9,8 @@
 
 CollisionSystem::CollisionSystem(ECSRegistry& registry)
     : SystemBase(registry)
-    , mAudioManager(nullptr)
+    , mEventBus(nullptr)
+    , mProjectilePool(nullptr)
 {
 }
 
@@ -37,115 +39,91 @@ void CollisionSystem::Shutdown() {
 void CollisionSystem::CheckProjectileCollisions() {
     using namespace Components;
     
-    // Collect projectiles to destroy to avoid iterator invalidation
-    std::vector<EntityID> projectilesToDestroy;
-    std::vector<std::pair<EntityID, EntityID>> collisions; // projectile, target
+    if (mProjectilePool == nullptr || mProjectilePool->Size() == 0) {
+        return;
+    }
     
-    // Check projectiles against ships
-    mRegistry.ForEach<Projectile>([&](EntityID projectileEntity, const Projectile& projectile) {
-        if (!projectile.isActive) {
-            return;
-        }
-        
-        auto* projectilePos = mRegistry.GetComponent<Position>(projectileEntity);
-        if (!projectilePos) {
-            return;
+    // Gather live ships once instead of looking them up per projectile
+    struct ShipTarget {
+        EntityID entity;
+        const Position* position;
+        Health* health;
+        SpacecraftType type;
+    };
+    std::vector<ShipTarget> ships;
+    mRegistry.ForEach<Spacecraft>([&](EntityID shipEntity, const Spacecraft& spacecraft) {
+        auto* shipPos = mRegistry.GetComponent<Position>(shipEntity);
+        auto* shipHealth = mRegistry.GetComponent<Health>(shipEntity);
+        if (shipPos && shipHealth && shipHealth->isAlive) {
+            ships.push_back({shipEntity, shipPos, shipHealth, spacecraft.type});
         }
-        
-        mRegistry.ForEach<Spacecraft>([&](EntityID shipEntity, const Spacecraft& spacecraft) {
-            auto* shipPos = mRegistry.GetComponent<Position>(shipEntity);
-            if (!shipPos) {
-                return;
-            }
-            
-            // Skip dead ships
-            auto* shipHealth = mRegistry.GetComponent<Health>(shipEntity);
-            if (!shipHealth || !shipHealth->isAlive) {
-                return;
-            }
-            
-            // Don't let projectiles hit their owner
-            if (projectile.ownerId == shipEntity) {
-                return;
-            }
-            
-            // Let projectiles pass through friendly ships - only check collision with enemies
-            auto* ownerSpacecraft = mRegistry.GetComponent<Spacecraft>(projectile.ownerId);
-            if (ownerSpacecraft && ownerSpacecraft->type == spacecraft.type) {
-                return; // Same team, projectile passes through
+    });
+    
+    const float* posX = mProjectilePool->GetPosX();
+    const float* posY = mProjectilePool->GetPosY();
+    const SpacecraftType* ownerType = mProjectilePool->GetOwnerType();
+    
+    // Walk backwards so removing a projectile only disturbs ones already checked
+    for (std::size_t i = mProjectilePool->Size(); i-- > 0;) {
+        for (const auto& ship : ships) {
+            // Projectiles pass through their owner and friendly ships
+            if (ship.type == ownerType[i] || !ship.health->isAlive) {
+                continue;
             }
             
-            // Check collision only with enemy ships
             if (CheckCircleCollision(
-                projectilePos->posX, projectilePos->posY, PROJECTILE_COLLISION_RADIUS,
-                shipPos->posX, shipPos->posY, SHIP_COLLISION_RADIUS)) {
+                posX[i], posY[i], PROJECTILE_COLLISION_RADIUS,
+                ship.position->posX, ship.position->posY, SHIP_COLLISION_RADIUS)) {
                 
-                collisions.emplace_back(projectileEntity, shipEntity);
+                HandleProjectileHit(i, ship.entity);
+                break;
             }
-        });
-    });
-    
-    // Process all collisions after iteration is complete
-    for (const auto& [projectileEntity, shipEntity] : collisions) {
-        HandleProjectileHit(projectileEntity, shipEntity);
+        }
     }
 }
 
 void CollisionSystem::CheckProjectilePlanetCollisions() {
     using namespace Components;
     
-    // Collect projectiles to destroy to avoid iterator invalidation
-    std::vector<EntityID> projectilesToDestroy;
-    std::vector<std::pair<EntityID, EntityID>> collisions; // projectile, planet
+    if (mProjectilePool == nullptr || mProjectilePool->Size() == 0) {
+        return;
+    }
     
-    // Check projectiles against planets
-    mRegistry.ForEach<Projectile>([&](EntityID projectileEntity, const Projectile& projectile) {
-        if (!projectile.isActive) {
-            return;
+    const float* posX = mProjectilePool->GetPosX();
+    const float* posY = mProjectilePool->GetPosY();
+    const SpacecraftType* ownerType = mProjectilePool->GetOwnerType();
+    const EntityID* target = mProjectilePool->GetTarget();
+    
+    for (std::size_t i = mProjectilePool->Size(); i-- > 0;) {
+        // Only collide with planets if they are the specific target
+        // If no specific target (INVALID_ENTITY), projectiles pass through planets
+        if (target[i] == INVALID_ENTITY) {
+            continue;
         }
         
-        auto* projectilePos = mRegistry.GetComponent<Position>(projectileEntity);
-        if (!projectilePos) {
-            return;
+        auto* planet = mRegistry.GetComponent<Planet>(target[i]);
+        if (!planet) {
+            continue; // Targeting a ship
         }
         
-        mRegistry.ForEach<Planet>([&](EntityID planetEntity, const Planet& planet) {
-            auto* planetPos = mRegistry.GetComponent<Position>(planetEntity);
-            if (!planetPos) {
-                return;
-            }
-            
-            // Skip dead planets
-            auto* planetHealth = mRegistry.GetComponent<Health>(planetEntity);
-            if (!planetHealth || !planetHealth->isAlive) {
-                return;
-            }
-            
-            // Don't let projectiles hit their owner's planet
-            auto* ownerSpacecraft = mRegistry.GetComponent<Spacecraft>(projectile.ownerId);
-            if (ownerSpacecraft && planet.isPlayerOwned == (ownerSpacecraft->type == SpacecraftType::Player)) {
-                return; // Same team, projectile passes through
-            }
-            
-            // Only collide with planets if they are the specific target
-            // If no specific target (INVALID_ENTITY), projectiles pass through planets
-            if (projectile.targetId != planetEntity) {
-                return; // Not targeting this planet, projectile passes through
-            }
+        auto* planetPos = mRegistry.GetComponent<Position>(target[i]);
+        auto* planetHealth = mRegistry.GetComponent<Health>(target[i]);
+        if (!planetPos || !planetHealth || !planetHealth->isAlive) {
+            continue;
+        }
+        
+        // Don't let projectiles hit their owner's planet
+        if (planet->isPlayerOwned == (ownerType[i] == SpacecraftType::Player)) {
+            continue; // Same team, projectile passes through
+        }
+        
+        // Check collision with planet
+        if (CheckCircleCollision(
+            posX[i], posY[i], PROJECTILE_COLLISION_RADIUS,
+            planetPos->posX, planetPos->posY, planet->radius)) {
             
-            // Check collision with planet
-            if (CheckCircleCollision(
-                projectilePos->posX, projectilePos->posY, PROJECTILE_COLLISION_RADIUS,
-                planetPos->posX, planetPos->posY, planet.radius)) {
-                
-                collisions.emplace_back(projectileEntity, planetEntity);
-            }
-        });
-    });
-    
-    // Process all collisions after iteration is complete
-    for (const auto& [projectileEntity, planetEntity] : collisions) {
-        HandleProjectileHit(projectileEntity, planetEntity);
+            HandleProjectileHit(i, target[i]);
+        }
     }
 }
 
@@ -216,48 +194,62 @@ bool CollisionSystem::CheckCircleCollision(float centerX1, float centerY1, float
     return distance <= (radius1 + radius2);
 }
 
-void CollisionSystem::HandleProjectileHit(EntityID projectile, EntityID target) {
-    using namespace Components;
-    
+void CollisionSystem::HandleProjectileHit(std::size_t projectileIndex, EntityID target) {
     // Damage the target
-    auto* health = mRegistry.GetComponent<Health>(target);
-    if (health && health->isAlive) {
-        health->currentHP -= 1;
-        if (health->currentHP <= 0) {
-            health->isAlive = false;
-            SDL_Log("Entity destroyed by projectile");
-            
-            // Play explosion sound effect
-            if (mAudioManager) {
-                mAudioManager->PlayBoom();
-            }
-        }
+    if (ApplyDamage(target)) {
+        SDL_Log("Entity destroyed by projectile");
     }
     
     // Remove the projectile
-    mRegistry.DestroyEntity(projectile);
+    mProjectilePool->Remove(projectileIndex);
 }
 
 void CollisionSystem::HandleShipCollision(EntityID ship1, EntityID ship2) {
+    // Simple collision response - damage both ships
+    ApplyDamage(ship1);
+    ApplyDamage(ship2);
+    
+    SDL_Log("Ship collision detected - both ships damaged");
+}
+
+bool CollisionSystem::ApplyDamage(EntityID entity) {
     using namespace Components;
     
-    // Simple collision response - damage both ships
-    auto* health1 = mRegistry.GetComponent<Health>(ship1);
-    auto* health2 = mRegistry.GetComponent<Health>(ship2);
+    auto* health = mRegistry.GetComponent<Health>(entity);
+    if (health == nullptr || !health->isAlive) {
+        return false;
+    }
     
-    if (health1 && health1->isAlive) {
-        health1->currentHP -= 1;
-        if (health1->currentHP <= 0) {
-            health1->isAlive = false;
-        }
+    health->currentHP -= 1;
+    if (health->currentHP > 0) {
+        PublishDamage(entity);
+        return false;
     }
     
-    if (health2 && health2->isAlive) {
-        health2->currentHP -= 1;
-        if (health2->currentHP <= 0) {
-            health2->isAlive = false;
-        }
+    health->isAlive = false;
+    PublishDeath(entity);
+    return true;
+}
+
+void CollisionSystem::PublishDamage(EntityID entity) {
+    if (mEventBus != nullptr) {
+        mEventBus->Publish({GameEventType::EntityDamaged, entity, 0.0F, 0.0F});
     }
+}
+
+void CollisionSystem::PublishDeath(EntityID entity) {
+    using namespace Components;
     
-    SDL_Log("Ship collision detected - both ships damaged");
+    if (mEventBus == nullptr) {
+        return;
+    }
+    
+    GameEvent event;
+    event.type = GameEventType::EntityDied;
+    event.entity = entity;
+    if (auto* position = mRegistry.GetComponent<Position>(entity)) {
+        event.posX = position->posX;
+        event.posY = position->posY;
+    }
+    mEventBus->Publish(event);
 }
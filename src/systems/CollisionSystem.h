@@ -2,9 +2,11 @@
 
 #include "../core/ECSRegistry.h"
 #include "../core/SystemBase.h"
+#include <cstddef>
 
-// Forward declaration
-class AudioManager;
+// Forward declarations
+class EventBus;
+class ProjectilePool;
 
 /**
  * @brief System for handling collision detection and response
@@ -14,8 +16,11 @@ public:
     explicit CollisionSystem(ECSRegistry& registry);
     ~CollisionSystem() override;
 
-    // Set audio manager for sound effects
-    void SetAudioManager(AudioManager* audioManager) { mAudioManager = audioManager; }
+    // Set event bus for death notifications
+    void SetEventBus(EventBus* eventBus) { mEventBus = eventBus; }
+
+    // Set pool of in-flight projectiles to test against ships and planets
+    void SetProjectilePool(ProjectilePool* projectilePool) { mProjectilePool = projectilePool; }
 
     // SystemBase interface
     bool Initialize() override;
@@ -34,15 +39,21 @@ private:
                              float x2, float y2, float radius2) const;
     
     // Handle collision responses
-    void HandleProjectileHit(EntityID projectile, EntityID target);
+    void HandleProjectileHit(std::size_t projectileIndex, EntityID target);
     void HandleShipCollision(EntityID ship1, EntityID ship2);
+    bool ApplyDamage(EntityID entity);
+    void PublishDeath(EntityID entity);
+    void PublishDamage(EntityID entity);
     
     // Constants
     static constexpr float SHIP_COLLISION_RADIUS = 0.04F;
     static constexpr float PROJECTILE_COLLISION_RADIUS = 0.02F;
     static constexpr float PLANET_COLLISION_RADIUS = 0.15F;
     
-    // Audio integration
-    AudioManager* mAudioManager;
+    // Event integration
+    EventBus* mEventBus;
+    
+    // Projectile storage
+    ProjectilePool* mProjectilePool;
 
 };
@@ -1,5 +1,7 @@
 #include "CombatSystem.h"
 #include "../components/Components.h"
+#include "../core/EventBus.h"
+#include "../core/ProjectilePool.h"
 #include "../rendering/AudioManager.h"
 #include <SDL2/SDL_log.h>
 #include <cmath>
@@ -36,6 +38,15 @@ void CombatSystem::Shutdown() {
     SDL_Log("Combat system shutdown");
 }
 
+void CombatSystem::SetEventBus(EventBus* eventBus) {
+    if (eventBus == nullptr) {
+        return;
+    }
+    
+    eventBus->Subscribe(GameEventType::EntitySpawned, [this](const GameEvent& event) { OnEntitySpawned(event); });
+    eventBus->Subscribe(GameEventType::EntityDied, [this](const GameEvent& event) { OnEntityDied(event); });
+}
+
 void CombatSystem::FireWeapon(EntityID shooter, EntityID targetEntity, float targetX, float targetY) {
     using namespace Components;
     
@@ -69,7 +80,7 @@ void CombatSystem::FireWeapon(EntityID shooter, EntityID targetEntity, float tar
     
     // Play weapon fire sound effect
     if (mAudioManager) {
-        mAudioManager->PlayPew();
+        mAudioManager->PlayPew(position->posX, position->posY);
     }
     
     // Set weapon cooldown
@@ -669,16 +680,14 @@ void CombatSystem::CreateProjectile(EntityID shooter, float startX, float startY
                                    float directionX, float directionY, float speed, EntityID targetEntity) {
     using namespace Components;
     
-    EntityID projectile = mRegistry.CreateEntity();
+    auto* spacecraft = mRegistry.GetComponent<Spacecraft>(shooter);
+    if (mProjectilePool == nullptr || !spacecraft) {
+        return;
+    }
     
-    mRegistry.AddComponent<Position>(projectile, {startX, startY});
-    mRegistry.AddComponent<Projectile>(projectile, {
-        directionX, directionY, speed, PROJECTILE_LIFETIME, shooter, targetEntity, true
-    });
-    mRegistry.AddComponent<Renderable>(projectile, {
-        1.0F, 1.0F, 0.0F, 1.0F, 0.5F // Yellow projectiles
-    });
-    mRegistry.AddComponent<Collider>(projectile, {0.02F, false});
+    // Shots are dropped silently if the pool is saturated
+    mProjectilePool->Spawn(startX, startY, directionX, directionY, speed, PROJECTILE_LIFETIME,
+                           shooter, spacecraft->type, targetEntity);
 }
 
 EntityID CombatSystem::FindNearestTarget(EntityID attacker, float maxRange) const {
@@ -946,7 +955,6 @@ void CombatSystem::CalculateDirection(float fromX, float fromY, float toX, float
 
 void CombatSystem::ProcessPlayerAutoAttack(float deltaTime) {
     using namespace Components;
-    (void)deltaTime; // Suppress unused parameter warning
     
     // Process all player units for auto-attack
     mRegistry.ForEach<Spacecraft>([&](EntityID entity, const Spacecraft& spacecraft) {
@@ -985,9 +993,9 @@ void CombatSystem::ProcessPlayerAutoAttack(float deltaTime) {
             }
         }
         
-        // Priority 2: If no specific target in range, attack nearest enemy
+        // Priority 2: If no specific target in range, attack nearest enemy (cached)
         if (target == INVALID_ENTITY) {
-            target = FindNearestTarget(entity, AI_FIRING_RANGE);
+            target = GetCachedAutoTarget(entity, *playerPos, deltaTime);
         }
         
         // Fire at the target if we have one
@@ -1009,6 +1017,83 @@ void CombatSystem::ProcessPlayerAutoAttack(float deltaTime) {
             }
         }
     });
+    
+    // Spawn invalidations have been applied to every player ship this pass
+    mRecentEnemySpawns.clear();
+}
+
+EntityID CombatSystem::GetCachedAutoTarget(EntityID entity, const Components::Position& position, float deltaTime) {
+    auto [iterator, inserted] = mTargetCache.try_emplace(entity);
+    TargetCache& cache = iterator->second;
+    
+    // Each ship's periodic search falls in one of several phases, so ships built or
+    // invalidated together don't all search on the same frame
+    const float bucketOffset = TARGET_REEVALUATION_INTERVAL *
+        static_cast<float>(entity % TARGET_REEVALUATION_BUCKETS) / static_cast<float>(TARGET_REEVALUATION_BUCKETS);
+    
+    if (inserted) {
+        cache.invalidated = true; // Find a first target right away
+    }
+    
+    cache.reevaluateTimer -= deltaTime;
+    
+    // A new enemy appearing within firing range may be closer than the cached one
+    for (const auto& [spawnX, spawnY] : mRecentEnemySpawns) {
+        if (CalculateDistance(position.posX, position.posY, spawnX, spawnY) <= AI_FIRING_RANGE) {
+            cache.invalidated = true;
+            break;
+        }
+    }
+    
+    // Target died or left range - look for a replacement right away
+    if (cache.target != INVALID_ENTITY && !IsCachedTargetValid(position, cache.target)) {
+        cache.target = INVALID_ENTITY;
+        cache.invalidated = true;
+    }
+    
+    if (cache.invalidated || cache.reevaluateTimer <= 0.0F) {
+        cache.target = FindNearestTarget(entity, AI_FIRING_RANGE);
+        if (inserted) {
+            cache.reevaluateTimer = bucketOffset;
+        } else if (cache.invalidated) {
+            // Out-of-schedule search: move back onto this ship's phase
+            cache.reevaluateTimer = TARGET_REEVALUATION_INTERVAL + bucketOffset;
+        } else {
+            // Scheduled search: advance by whole intervals so the phase is kept
+            cache.reevaluateTimer = std::max(cache.reevaluateTimer + TARGET_REEVALUATION_INTERVAL, 0.0F);
+        }
+        cache.invalidated = false;
+    }
+    
+    return cache.target;
+}
+
+bool CombatSystem::IsCachedTargetValid(const Components::Position& position, EntityID target) const {
+    using namespace Components;
+    
+    auto* targetPos = mRegistry.GetComponent<Position>(target);
+    auto* targetHealth = mRegistry.GetComponent<Health>(target);
+    if (!targetPos || !targetHealth || !targetHealth->isAlive) {
+        return false;
+    }
+    
+    return CalculateDistance(position.posX, position.posY, targetPos->posX, targetPos->posY) <= AI_FIRING_RANGE;
+}
+
+void CombatSystem::OnEntitySpawned(const GameEvent& event) {
+    using namespace Components;
+    
+    // Only enemy arrivals can change what player ships should shoot at
+    auto* spacecraft = mRegistry.GetComponent<Spacecraft>(event.entity);
+    if (spacecraft && spacecraft->type == SpacecraftType::Enemy) {
+        mRecentEnemySpawns.emplace_back(event.posX, event.posY);
+    }
+}
+
+void CombatSystem::OnEntityDied(const GameEvent& event) {
+    // Dead ships no longer need a cache entry; caches pointing at the dead
+    // entity are dropped by the validity check on their next pass
+    mTargetCache.erase(event.entity);
 }
 
 void CombatSystem::CoordinateGroupTactics(float deltaTime) {
@@ -3,9 +3,14 @@
 #include "../core/ECSRegistry.h"
 #include "../core/SystemBase.h"
 #include "../components/Components.h"
+#include <unordered_map>
+#include <vector>
 
 // Forward declarations
 class AudioManager;
+class EventBus;
+class ProjectilePool;
+struct GameEvent;
 
 /**
  * @brief System for handling combat mechanics, shooting, and weapon systems
@@ -18,6 +23,12 @@ public:
     // Set audio manager for sound effects
     void SetAudioManager(AudioManager* audioManager) { mAudioManager = audioManager; }
 
+    // Subscribe to spawn/death events used to invalidate cached targets
+    void SetEventBus(EventBus* eventBus);
+
+    // Set pool that fired projectiles are stored in
+    void SetProjectilePool(ProjectilePool* projectilePool) { mProjectilePool = projectilePool; }
+
     // SystemBase interface
     bool Initialize() override;
     void Update(float deltaTime) override;
@@ -35,6 +46,18 @@ private:
     void CreateProjectile(EntityID shooter, float startX, float startY, 
                          float directionX, float directionY, float speed = 2.0F, EntityID targetEntity = INVALID_ENTITY);
     
+    // Auto-attack target caching
+    struct TargetCache {
+        EntityID target = INVALID_ENTITY;
+        float reevaluateTimer = 0.0F; // Time until the next full nearest-target search
+        bool invalidated = false;     // Set by events that may change the best target
+    };
+    
+    EntityID GetCachedAutoTarget(EntityID entity, const Components::Position& position, float deltaTime);
+    bool IsCachedTargetValid(const Components::Position& position, EntityID target) const;
+    void OnEntitySpawned(const GameEvent& event);
+    void OnEntityDied(const GameEvent& event);
+    
     // AI helpers
     EntityID FindNearestTarget(EntityID attacker, float maxRange) const;
     EntityID FindNearestPlanet(EntityID attacker, float maxRange) const;
@@ -115,6 +138,8 @@ private:
     static constexpr float PROJECTILE_LIFETIME = 1.5F; // Reduced for shorter range
     static constexpr float AI_FIRING_RANGE = 0.5F; // Reduced to match projectile range
     static constexpr float AI_UPDATE_INTERVAL = 0.1F; // AI decision making frequency
+    static constexpr float TARGET_REEVALUATION_INTERVAL = 0.25F; // Auto-attack retarget cadence
+    static constexpr int TARGET_REEVALUATION_BUCKETS = 8; // Spread retargeting across frames
     
     // Advanced AI tactical constants
     static constexpr float TACTICAL_ANALYSIS_RANGE = 0.8F; // Range for counting nearby units
@@ -145,6 +170,13 @@ private:
     bool mMassAttackInProgress;
     bool mSurroundInProgress;
     
+    // Auto-attack target cache state
+    std::unordered_map<EntityID, TargetCache> mTargetCache;
+    std::vector<std::pair<float, float>> mRecentEnemySpawns; // Positions spawned since last auto-attack pass
+    
     // Audio integration
     AudioManager* mAudioManager;
+    
+    // Projectile storage
+    ProjectilePool* mProjectilePool = nullptr;
 };
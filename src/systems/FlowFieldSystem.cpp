@@ -0,0 +1,302 @@
+#include "FlowFieldSystem.h"
+#include "../components/Components.h"
+#include <SDL2/SDL_log.h>
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <utility>
+
+namespace {
+    // 8-connected neighborhood: offsets, step costs and normalized directions
+    constexpr int NEIGHBOR_COUNT = 8;
+    constexpr int NEIGHBOR_DX[NEIGHBOR_COUNT] = {1, -1, 0, 0, 1, 1, -1, -1};
+    constexpr int NEIGHBOR_DY[NEIGHBOR_COUNT] = {0, 0, 1, -1, 1, -1, 1, -1};
+    constexpr float DIAGONAL_COST = 1.41421356F;
+    constexpr float DIAGONAL_DIR = 0.70710678F;
+    constexpr float NEIGHBOR_COST[NEIGHBOR_COUNT] = {
+        1.0F, 1.0F, 1.0F, 1.0F, DIAGONAL_COST, DIAGONAL_COST, DIAGONAL_COST, DIAGONAL_COST
+    };
+    constexpr float NEIGHBOR_DIR_X[NEIGHBOR_COUNT] = {
+        1.0F, -1.0F, 0.0F, 0.0F, DIAGONAL_DIR, DIAGONAL_DIR, -DIAGONAL_DIR, -DIAGONAL_DIR
+    };
+    constexpr float NEIGHBOR_DIR_Y[NEIGHBOR_COUNT] = {
+        0.0F, 0.0F, 1.0F, -1.0F, DIAGONAL_DIR, -DIAGONAL_DIR, DIAGONAL_DIR, -DIAGONAL_DIR
+    };
+    constexpr float UNREACHABLE = std::numeric_limits<float>::max();
+}
+
+FlowFieldSystem::FlowFieldSystem(ECSRegistry& registry)
+    : SystemBase(registry)
+    , mBlocked(CELL_COUNT, 0)
+    , mIntegration(CELL_COUNT, UNREACHABLE)
+    , mFields()
+    , mNextGeneration(1) // Generation 0 would produce INVALID_FIELD for slot 0
+{
+}
+
+FlowFieldSystem::~FlowFieldSystem() {
+    Shutdown();
+}
+
+bool FlowFieldSystem::Initialize() {
+    SDL_Log("Flow field system initialized (%dx%d grid)", GRID_WIDTH, GRID_HEIGHT);
+    return true;
+}
+
+void FlowFieldSystem::Update(float deltaTime) {
+    // Release fields no ship has requested or followed in a while
+    for (auto& field : mFields) {
+        if (field.id == INVALID_FIELD) {
+            continue;
+        }
+
+        field.idleTime += deltaTime;
+        if (field.idleTime > FIELD_EXPIRY_TIME) {
+            field.id = INVALID_FIELD;
+            field.goalCell = -1;
+        }
+    }
+}
+
+void FlowFieldSystem::Shutdown() {
+    SDL_Log("Flow field system shutdown");
+}
+
+std::uint32_t FlowFieldSystem::RequestField(float goalX, float goalY, float arrivalRadius) {
+    int goalCell = WorldToCell(goalX, goalY);
+    if (goalCell < 0) {
+        return INVALID_FIELD;
+    }
+    int arrivalCells = static_cast<int>(std::ceil(arrivalRadius / CELL_SIZE));
+
+    // Reuse an existing field that leads to the same cell
+    for (auto& field : mFields) {
+        if (field.id != INVALID_FIELD && field.goalCell == goalCell && field.arrivalCells == arrivalCells) {
+            field.idleTime = 0.0F;
+            return field.id;
+        }
+    }
+
+    RebuildObstacles();
+
+    auto slot = static_cast<std::uint32_t>(FindSlotForNewField());
+    FlowField& field = mFields[slot];
+    field.id = (mNextGeneration++ << SLOT_BITS) | slot;
+    field.goalCell = goalCell;
+    field.arrivalCells = arrivalCells;
+    field.idleTime = 0.0F;
+    BuildField(field);
+
+    return field.id;
+}
+
+bool FlowFieldSystem::SampleDirection(std::uint32_t fieldId, float posX, float posY, float& dirX, float& dirY) {
+    FlowField& field = mFields[fieldId & (MAX_FIELDS - 1)];
+    if (fieldId == INVALID_FIELD || field.id != fieldId) {
+        return false; // Field was evicted
+    }
+    field.idleTime = 0.0F;
+
+    int cell = WorldToCell(posX, posY);
+    if (cell < 0) {
+        return false;
+    }
+
+    dirX = field.directionX[cell];
+    dirY = field.directionY[cell];
+
+    // Goal, blocked and unreachable cells carry no direction
+    return dirX != 0.0F || dirY != 0.0F;
+}
+
+void FlowFieldSystem::RebuildObstacles() {
+    using namespace Components;
+
+    std::fill(mBlocked.begin(), mBlocked.end(), 0);
+
+    mRegistry.ForEach<Planet>([&](EntityID entity, const Planet& planet) {
+        auto* position = mRegistry.GetComponent<Position>(entity);
+        if (!position) {
+            return;
+        }
+
+        float blockRadius = planet.radius + OBSTACLE_MARGIN;
+        int minCellX = std::max(0, static_cast<int>((position->posX - blockRadius - GRID_MIN_X) / CELL_SIZE));
+        int maxCellX = std::min(GRID_WIDTH - 1, static_cast<int>((position->posX + blockRadius - GRID_MIN_X) / CELL_SIZE));
+        int minCellY = std::max(0, static_cast<int>((position->posY - blockRadius - GRID_MIN_Y) / CELL_SIZE));
+        int maxCellY = std::min(GRID_HEIGHT - 1, static_cast<int>((position->posY + blockRadius - GRID_MIN_Y) / CELL_SIZE));
+
+        for (int cellY = minCellY; cellY <= maxCellY; ++cellY) {
+            for (int cellX = minCellX; cellX <= maxCellX; ++cellX) {
+                float centerX = GRID_MIN_X + (static_cast<float>(cellX) + 0.5F) * CELL_SIZE;
+                float centerY = GRID_MIN_Y + (static_cast<float>(cellY) + 0.5F) * CELL_SIZE;
+                float deltaX = centerX - position->posX;
+                float deltaY = centerY - position->posY;
+                if ((deltaX * deltaX) + (deltaY * deltaY) <= blockRadius * blockRadius) {
+                    mBlocked[(cellY * GRID_WIDTH) + cellX] = 1;
+                }
+            }
+        }
+    });
+}
+
+void FlowFieldSystem::BuildField(FlowField& field) {
+    std::fill(mIntegration.begin(), mIntegration.end(), UNREACHABLE);
+    field.directionX.assign(CELL_COUNT, 0.0F);
+    field.directionY.assign(CELL_COUNT, 0.0F);
+
+    // A cell is walkable if it is open, or is the goal itself (goals may sit on a planet)
+    auto isWalkable = [&](int cell) { return mBlocked[cell] == 0 || cell == field.goalCell; };
+
+    // Diagonal moves may not cut the corner of a blocked cell
+    auto canStep = [&](int cellX, int cellY, int neighbor) {
+        int nextX = cellX + NEIGHBOR_DX[neighbor];
+        int nextY = cellY + NEIGHBOR_DY[neighbor];
+        if (nextX < 0 || nextX >= GRID_WIDTH || nextY < 0 || nextY >= GRID_HEIGHT) {
+            return false;
+        }
+        if (!isWalkable((nextY * GRID_WIDTH) + nextX)) {
+            return false;
+        }
+        if (NEIGHBOR_DX[neighbor] != 0 && NEIGHBOR_DY[neighbor] != 0) {
+            return isWalkable((cellY * GRID_WIDTH) + nextX) && isWalkable((nextY * GRID_WIDTH) + cellX);
+        }
+        return true;
+    };
+
+    // Integration pass: Dijkstra outward from the goal
+    using OpenEntry = std::pair<float, int>;
+    std::priority_queue<OpenEntry, std::vector<OpenEntry>, std::greater<>> open;
+    mIntegration[field.goalCell] = 0.0F;
+    open.emplace(0.0F, field.goalCell);
+
+    while (!open.empty()) {
+        auto [cost, cell] = open.top();
+        open.pop();
+        if (cost > mIntegration[cell]) {
+            continue; // Stale entry
+        }
+
+        int cellX = cell % GRID_WIDTH;
+        int cellY = cell / GRID_WIDTH;
+        for (int neighbor = 0; neighbor < NEIGHBOR_COUNT; ++neighbor) {
+            if (!canStep(cellX, cellY, neighbor)) {
+                continue;
+            }
+
+            int next = ((cellY + NEIGHBOR_DY[neighbor]) * GRID_WIDTH) + cellX + NEIGHBOR_DX[neighbor];
+            float nextCost = cost + NEIGHBOR_COST[neighbor];
+            if (nextCost < mIntegration[next]) {
+                mIntegration[next] = nextCost;
+                open.emplace(nextCost, next);
+            }
+        }
+    }
+
+    // Flow pass: each reachable cell points at its cheapest neighbor
+    for (int cell = 0; cell < CELL_COUNT; ++cell) {
+        if (cell == field.goalCell || mBlocked[cell] != 0 || mIntegration[cell] == UNREACHABLE) {
+            continue;
+        }
+
+        int cellX = cell % GRID_WIDTH;
+        int cellY = cell / GRID_WIDTH;
+        float bestCost = mIntegration[cell];
+        int bestNeighbor = -1;
+
+        for (int neighbor = 0; neighbor < NEIGHBOR_COUNT; ++neighbor) {
+            if (!canStep(cellX, cellY, neighbor)) {
+                continue;
+            }
+
+            int next = ((cellY + NEIGHBOR_DY[neighbor]) * GRID_WIDTH) + cellX + NEIGHBOR_DX[neighbor];
+            if (mIntegration[next] < bestCost) {
+                bestCost = mIntegration[next];
+                bestNeighbor = neighbor;
+            }
+        }
+
+        if (bestNeighbor >= 0) {
+            field.directionX[cell] = NEIGHBOR_DIR_X[bestNeighbor];
+            field.directionY[cell] = NEIGHBOR_DIR_Y[bestNeighbor];
+        }
+    }
+
+    // Inside the arrival area ships head straight for their formation slots, except
+    // where a planet lies between them and the goal and the field must lead around it
+    int goalX = field.goalCell % GRID_WIDTH;
+    int goalY = field.goalCell / GRID_WIDTH;
+    for (int offsetY = -field.arrivalCells; offsetY <= field.arrivalCells; ++offsetY) {
+        for (int offsetX = -field.arrivalCells; offsetX <= field.arrivalCells; ++offsetX) {
+            int cellX = goalX + offsetX;
+            int cellY = goalY + offsetY;
+            if (cellX < 0 || cellX >= GRID_WIDTH || cellY < 0 || cellY >= GRID_HEIGHT) {
+                continue;
+            }
+            if ((offsetX * offsetX) + (offsetY * offsetY) <= field.arrivalCells * field.arrivalCells) {
+                int cell = (cellY * GRID_WIDTH) + cellX;
+                if (mBlocked[cell] == 0 && IsPathClear(cell, field.goalCell)) {
+                    field.directionX[cell] = 0.0F;
+                    field.directionY[cell] = 0.0F;
+                }
+            }
+        }
+    }
+}
+
+int FlowFieldSystem::FindSlotForNewField() {
+    int slot = 0;
+    float oldestIdleTime = -1.0F;
+
+    for (std::uint32_t i = 0; i < MAX_FIELDS; ++i) {
+        if (mFields[i].id == INVALID_FIELD) {
+            return static_cast<int>(i);
+        }
+
+        // Otherwise evict the least recently requested field
+        if (mFields[i].idleTime > oldestIdleTime) {
+            oldestIdleTime = mFields[i].idleTime;
+            slot = static_cast<int>(i);
+        }
+    }
+
+    return slot;
+}
+
+int FlowFieldSystem::WorldToCell(float worldX, float worldY) const {
+    float localX = (worldX - GRID_MIN_X) / CELL_SIZE;
+    float localY = (worldY - GRID_MIN_Y) / CELL_SIZE;
+    if (localX < 0.0F || localY < 0.0F) {
+        return -1;
+    }
+
+    int cellX = static_cast<int>(localX);
+    int cellY = static_cast<int>(localY);
+    if (cellX >= GRID_WIDTH || cellY >= GRID_HEIGHT) {
+        return -1;
+    }
+
+    return (cellY * GRID_WIDTH) + cellX;
+}
+
+bool FlowFieldSystem::IsPathClear(int fromCell, int toCell) const {
+    int fromX = fromCell % GRID_WIDTH;
+    int fromY = fromCell / GRID_WIDTH;
+    int deltaX = (toCell % GRID_WIDTH) - fromX;
+    int deltaY = (toCell / GRID_WIDTH) - fromY;
+
+    // Sample the segment twice per cell so it cannot step over a blocked cell
+    int steps = 2 * std::max(std::abs(deltaX), std::abs(deltaY));
+    for (int step = 1; step < steps; ++step) {
+        float fraction = static_cast<float>(step) / static_cast<float>(steps);
+        int cellX = fromX + static_cast<int>(std::lround(fraction * static_cast<float>(deltaX)));
+        int cellY = fromY + static_cast<int>(std::lround(fraction * static_cast<float>(deltaY)));
+        int cell = (cellY * GRID_WIDTH) + cellX;
+        if (cell != toCell && mBlocked[cell] != 0) {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "../core/ECSRegistry.h"
+#include "../core/SystemBase.h"
+#include <array>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Grid-based flow-field pathing for group move orders
+ *
+ * A move order builds one integration field outward from the goal cell, with
+ * planets marked as impassable. Every ship sent to that goal then samples its
+ * steering direction from the field in constant time instead of planning
+ * its own route.
+ */
+class FlowFieldSystem : public SystemBase {
+public:
+    explicit FlowFieldSystem(ECSRegistry& registry);
+    ~FlowFieldSystem() override;
+
+    // SystemBase interface
+    bool Initialize() override;
+    void Update(float deltaTime) override;
+    void Shutdown() override;
+
+    /**
+     * @brief Get a field leading to a world position, building it if needed
+     * @param goalX Goal X in world space
+     * @param goalY Goal Y in world space
+     * @param arrivalRadius Radius around the goal where ships steer straight to their own slot
+     * @return Field handle to store on ships, or INVALID_FIELD if the goal is off-grid
+     */
+    std::uint32_t RequestField(float goalX, float goalY, float arrivalRadius = 0.0F);
+
+    /**
+     * @brief Sample the steering direction for a position
+     * @param fieldId Handle returned by RequestField
+     * @param posX Ship X in world space
+     * @param posY Ship Y in world space
+     * @param dirX Output normalized direction X
+     * @param dirY Output normalized direction Y
+     * @return false if the field expired or the ship should steer straight to its goal
+     *
+     * Sampling keeps the field alive, so it is never evicted while ships follow it.
+     */
+    bool SampleDirection(std::uint32_t fieldId, float posX, float posY, float& dirX, float& dirY);
+
+    static constexpr std::uint32_t INVALID_FIELD = 0;
+
+private:
+    struct FlowField {
+        std::uint32_t id = INVALID_FIELD;
+        int goalCell = -1;
+        int arrivalCells = 0;               // Radius around the goal left without directions
+        float idleTime = 0.0F;              // Time since the field was last requested or sampled
+        std::vector<float> directionX;      // Per-cell steering direction
+        std::vector<float> directionY;
+    };
+
+    // Field construction
+    void RebuildObstacles();
+    void BuildField(FlowField& field);
+    int FindSlotForNewField();
+
+    // Grid helpers
+    int WorldToCell(float worldX, float worldY) const;
+    bool IsPathClear(int fromCell, int toCell) const;
+
+    // Grid layout - covers the visible play area plus the off-screen spawn ring
+    static constexpr float GRID_MIN_X = -1.3F;
+    static constexpr float GRID_MIN_Y = -1.0F;
+    static constexpr float CELL_SIZE = 0.025F;
+    static constexpr int GRID_WIDTH = 104;
+    static constexpr int GRID_HEIGHT = 80;
+    static constexpr int CELL_COUNT = GRID_WIDTH * GRID_HEIGHT;
+
+    // Field cache
+    static constexpr std::uint32_t SLOT_BITS = 4;
+    static constexpr std::uint32_t MAX_FIELDS = 1U << SLOT_BITS;
+    static constexpr float FIELD_EXPIRY_TIME = 30.0F;
+    static constexpr float OBSTACLE_MARGIN = 0.03F; // Clearance kept around planets
+
+    std::vector<std::uint8_t> mBlocked;
+    std::vector<float> mIntegration; // Scratch buffer reused by every build
+    std::array<FlowField, MAX_FIELDS> mFields;
+    std::uint32_t mNextGeneration;
+};
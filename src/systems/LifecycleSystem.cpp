@@ -0,0 +1,49 @@
+#include "LifecycleSystem.h"
+#include "../components/Components.h"
+#include "../core/EventBus.h"
+#include <SDL2/SDL_log.h>
+
+LifecycleSystem::LifecycleSystem(ECSRegistry& registry)
+    : SystemBase(registry)
+    , mPendingDestroy()
+{
+}
+
+LifecycleSystem::~LifecycleSystem() {
+    Shutdown();
+}
+
+void LifecycleSystem::SetEventBus(EventBus* eventBus) {
+    if (eventBus == nullptr) {
+        return;
+    }
+    
+    eventBus->Subscribe(GameEventType::EntityDied, [this](const GameEvent& event) {
+        mPendingDestroy.push_back(event.entity);
+    });
+}
+
+bool LifecycleSystem::Initialize() {
+    SDL_Log("Lifecycle system initialized");
+    return true;
+}
+
+void LifecycleSystem::Update(float deltaTime) {
+    using namespace Components;
+    (void)deltaTime; // Suppress unused parameter warning
+    
+    // Listeners have already reacted to these deaths, so the entities can go
+    for (EntityID entity : mPendingDestroy) {
+        if (mRegistry.GetComponent<Planet>(entity) != nullptr) {
+            continue;
+        }
+        
+        mRegistry.DestroyEntity(entity);
+    }
+    
+    mPendingDestroy.clear();
+}
+
+void LifecycleSystem::Shutdown() {
+    SDL_Log("Lifecycle system shutdown");
+}
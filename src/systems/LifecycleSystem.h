@@ -0,0 +1,35 @@
+#pragma once
+
+#include "../core/ECSRegistry.h"
+#include "../core/SystemBase.h"
+#include <vector>
+
+// Forward declarations
+class EventBus;
+
+/**
+ * @brief Reclaims dead units at a fixed point in the frame
+ *
+ * Deaths are announced on the event bus the moment they happen, so score,
+ * selection, audio and combat listeners can still read the entity's
+ * components. The lifecycle system queues every death it hears about and
+ * destroys those entities once all other systems have updated, keeping
+ * per-frame iteration proportional to the living units. Planets are kept
+ * since gameplay tracks destroyed planets for the game over check.
+ */
+class LifecycleSystem : public SystemBase {
+public:
+    explicit LifecycleSystem(ECSRegistry& registry);
+    ~LifecycleSystem() override;
+
+    // Subscribe to death events
+    void SetEventBus(EventBus* eventBus);
+
+    // SystemBase interface
+    bool Initialize() override;
+    void Update(float deltaTime) override;
+    void Shutdown() override;
+
+private:
+    std::vector<EntityID> mPendingDestroy; // Died this frame, reclaimed in Update
+};
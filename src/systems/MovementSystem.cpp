@@ -1,6 +1,9 @@
 #include "MovementSystem.h"
 #include "../components/Components.h"
+#include "FlowFieldSystem.h"
+#include "../core/ProjectilePool.h"
 #include <SDL2/SDL_log.h>
+#include <algorithm>
 #include <cmath>
 
 MovementSystem::MovementSystem(ECSRegistry& registry)
@@ -34,6 +37,13 @@ void MovementSystem::UpdateSpacecraftMovement(float deltaTime) {
     
     // Second pass: Update spacecraft movement and rotation
     mRegistry.ForEach<Spacecraft>([&](EntityID entity, Spacecraft& spacecraft) {
+        // A new order wakes a ship; otherwise sleeping ships stay where they are
+        if (spacecraft.isMoving) {
+            spacecraft.isAsleep = false;
+        } else if (spacecraft.isAsleep) {
+            return;
+        }
+        
         auto* position = mRegistry.GetComponent<Position>(entity);
         auto* health = mRegistry.GetComponent<Health>(entity);
         if (!position || !health || !health->isAlive) {
@@ -94,19 +104,36 @@ void MovementSystem::UpdateSpacecraftMovement(float deltaTime) {
                 float deltaY = spacecraft.destY - position->posY;
                 float distance = CalculateDistance(position->posX, position->posY, spacecraft.destX, spacecraft.destY);
                 
-                // Check if we've arrived at destination
-                if (distance < ARRIVAL_THRESHOLD) {
+                // Check if we've arrived at our formation slot
+                if (distance < SLOT_ARRIVAL_THRESHOLD) {
                     spacecraft.isMoving = false;
+                    spacecraft.flowFieldId = FlowFieldSystem::INVALID_FIELD;
                     return;
                 }
                 
-                // Normalize direction
+                // Follow the shared flow field around planets, or head straight for the slot
                 float dirX = deltaX / distance;
                 float dirY = deltaY / distance;
+                bool followingFlow = false;
+                if (spacecraft.flowFieldId != FlowFieldSystem::INVALID_FIELD && mFlowFieldSystem != nullptr) {
+                    float flowX = 0.0F;
+                    float flowY = 0.0F;
+                    if (mFlowFieldSystem->SampleDirection(spacecraft.flowFieldId, position->posX, position->posY, flowX, flowY)) {
+                        dirX = flowX;
+                        dirY = flowY;
+                        followingFlow = true;
+                    }
+                }
+                
+                // Don't overshoot the slot on the final step
+                float step = SHIP_SPEED * deltaTime;
+                if (!followingFlow) {
+                    step = std::min(step, distance);
+                }
                 
                 // Update position
-                position->posX += dirX * SHIP_SPEED * deltaTime;
-                position->posY += dirY * SHIP_SPEED * deltaTime;
+                position->posX += dirX * step;
+                position->posY += dirY * step;
                 
                 // Update angle to face movement direction
                 spacecraft.angle = (std::atan2(dirY, dirX) * 180.0F / 3.14159F) - 90.0F;
@@ -145,38 +172,40 @@ void MovementSystem::UpdateSpacecraftMovement(float deltaTime) {
             // Only update angle for player ships that aren't currently moving (to handle separation forces)
             spacecraft.angle = (std::atan2(movementY, movementX) * 180.0F / 3.14159F) - 90.0F;
         }
+        
+        // Idle ships that nobody has pushed for a while go to sleep
+        if (!spacecraft.isMoving && spacecraft.restTime >= SLEEP_DELAY) {
+            spacecraft.isAsleep = true;
+        }
     });
 }
 
 void MovementSystem::UpdateProjectileMovement(float deltaTime) {
-    using namespace Components;
+    if (mProjectilePool == nullptr) {
+        return;
+    }
     
-    // Collect entities to destroy to avoid iterator invalidation
-    std::vector<EntityID> entitiesToDestroy;
+    float* posX = mProjectilePool->GetPosX();
+    float* posY = mProjectilePool->GetPosY();
+    float* lifetime = mProjectilePool->GetLifetime();
+    const float* dirX = mProjectilePool->GetDirX();
+    const float* dirY = mProjectilePool->GetDirY();
+    const float* speed = mProjectilePool->GetSpeed();
     
-    mRegistry.ForEach<Projectile>([&](EntityID entity, Projectile& projectile) {
-        auto* position = mRegistry.GetComponent<Position>(entity);
-        if (!position) {
-            return;
-        }
-        
-        if (projectile.isActive) {
-            // Update position based on direction
-            position->posX += projectile.directionX * projectile.speed * deltaTime;
-            position->posY += projectile.directionY * projectile.speed * deltaTime;
-            
-            // Update lifetime
-            projectile.lifetime -= deltaTime;
-            if (projectile.lifetime <= 0.0F) {
-                projectile.isActive = false;
-                entitiesToDestroy.push_back(entity);
-            }
-        }
-    });
+    // Advance every projectile in one linear pass over the arrays
+    std::size_t count = mProjectilePool->Size();
+    for (std::size_t i = 0; i < count; ++i) {
+        float step = speed[i] * deltaTime;
+        posX[i] += dirX[i] * step;
+        posY[i] += dirY[i] * step;
+        lifetime[i] -= deltaTime;
+    }
     
-    // Safely destroy entities after iteration
-    for (EntityID entity : entitiesToDestroy) {
-        mRegistry.DestroyEntity(entity);
+    // Expire old projectiles; walk backwards since removal swaps in the last element
+    for (std::size_t i = count; i-- > 0;) {
+        if (lifetime[i] <= 0.0F) {
+            mProjectilePool->Remove(i);
+        }
     }
 }
 
@@ -196,11 +225,13 @@ void MovementSystem::ApplySeparationForces(float deltaTime) {
         }
     });
     
-    // Apply separation forces to prevent ships from stacking
+    // Apply separation forces to prevent ships from stacking. Only awake ships are
+    // pushed; sleeping ships still push back and are woken when something overlaps them
     for (size_t i = 0; i < spacecraftPositions.size(); ++i) {
         EntityID id = spacecraftPositions[i].first;
         Position* pos = spacecraftPositions[i].second;
         Spacecraft* spacecraft = spacecraftData[i].second;
+        if (spacecraft->isAsleep) continue;
         
         // Calculate separation force from nearby ships
         float separationX = 0.0F;
@@ -230,6 +261,11 @@ void MovementSystem::ApplySeparationForces(float deltaTime) {
                 separationX += (deltaX / distance) * force * deltaTime;
                 separationY += (deltaY / distance) * force * deltaTime;
                 nearbyCount++;
+                
+                if (otherSpacecraft->isAsleep) {
+                    otherSpacecraft->isAsleep = false;
+                    otherSpacecraft->restTime = 0.0F;
+                }
             }
         }
         
@@ -237,6 +273,9 @@ void MovementSystem::ApplySeparationForces(float deltaTime) {
         if (nearbyCount > 0) {
             pos->posX += separationX;
             pos->posY += separationY;
+            spacecraft->restTime = 0.0F;
+        } else {
+            spacecraft->restTime += deltaTime;
         }
     }
 }
@@ -3,6 +3,10 @@
 #include "../core/ECSRegistry.h"
 #include "../core/SystemBase.h"
 
+// Forward declarations
+class FlowFieldSystem;
+class ProjectilePool;
+
 /**
  * @brief System for handling entity movement and navigation
  */
@@ -16,6 +20,12 @@ public:
     void Update(float deltaTime) override;
     void Shutdown() override;
 
+    // Set flow field system used to steer ships around planets
+    void SetFlowFieldSystem(FlowFieldSystem* flowFieldSystem) { mFlowFieldSystem = flowFieldSystem; }
+
+    // Set pool of in-flight projectiles to advance each frame
+    void SetProjectilePool(ProjectilePool* projectilePool) { mProjectilePool = projectilePool; }
+
 private:
     // Movement calculations
     void UpdateSpacecraftMovement(float deltaTime);
@@ -31,4 +41,12 @@ private:
     static constexpr float SHIP_ROTATION_SPEED = 3.0F;
     static constexpr float PROJECTILE_SPEED = 2.0F;
     static constexpr float ARRIVAL_THRESHOLD = 0.05F;
+    static constexpr float SLOT_ARRIVAL_THRESHOLD = 0.01F; // Formation slots need tighter arrival
+    static constexpr float SLEEP_DELAY = 0.5F; // Undisturbed idle time before a ship sleeps
+    
+    // Pathing integration
+    FlowFieldSystem* mFlowFieldSystem = nullptr;
+    
+    // Projectile storage
+    ProjectilePool* mProjectilePool = nullptr;
 };
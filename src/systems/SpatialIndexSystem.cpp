@@ -0,0 +1,62 @@
+#include "SpatialIndexSystem.h"
+#include "../components/Components.h"
+#include <SDL2/SDL_log.h>
+
+SpatialIndexSystem::SpatialIndexSystem(ECSRegistry& registry)
+    : SystemBase(registry)
+    , mShipGrid(INDEX_MIN_X, INDEX_MIN_Y, INDEX_MAX_X, INDEX_MAX_Y, SHIP_CELL_SIZE)
+    , mPlanetGrid(INDEX_MIN_X, INDEX_MIN_Y, INDEX_MAX_X, INDEX_MAX_Y, PLANET_CELL_SIZE)
+{
+}
+
+SpatialIndexSystem::~SpatialIndexSystem() {
+    Shutdown();
+}
+
+bool SpatialIndexSystem::Initialize() {
+    SDL_Log("Spatial index system initialized");
+    return true;
+}
+
+void SpatialIndexSystem::Update(float deltaTime) {
+    using namespace Components;
+    (void)deltaTime; // Suppress unused parameter warning
+    
+    mShipGrid.Clear();
+    mRegistry.ForEach<Spacecraft>([this](EntityID entity, Spacecraft& spacecraft) {
+        (void)spacecraft;
+        auto* position = mRegistry.GetComponent<Position>(entity);
+        auto* health = mRegistry.GetComponent<Health>(entity);
+        if (position == nullptr || health == nullptr || !health->isAlive) {
+            return;
+        }
+        
+        mShipGrid.Insert(entity, position->posX, position->posY);
+    });
+    mShipGrid.Build();
+    
+    // Destroyed planets stay in the registry and are still drawn
+    mPlanetGrid.Clear();
+    mRegistry.ForEach<Planet>([this](EntityID entity, Planet& planet) {
+        (void)planet;
+        auto* position = mRegistry.GetComponent<Position>(entity);
+        if (position == nullptr) {
+            return;
+        }
+        
+        mPlanetGrid.Insert(entity, position->posX, position->posY);
+    });
+    mPlanetGrid.Build();
+}
+
+void SpatialIndexSystem::Shutdown() {
+    SDL_Log("Spatial index system shutdown");
+}
+
+void SpatialIndexSystem::QueryShips(float minX, float minY, float maxX, float maxY, std::vector<EntityID>& results) const {
+    mShipGrid.Query(minX, minY, maxX, maxY, results);
+}
+
+void SpatialIndexSystem::QueryPlanets(float minX, float minY, float maxX, float maxY, std::vector<EntityID>& results) const {
+    mPlanetGrid.Query(minX, minY, maxX, maxY, results);
+}
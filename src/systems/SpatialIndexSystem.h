@@ -0,0 +1,48 @@
+#pragma once
+
+#include "../core/ECSRegistry.h"
+#include "../core/SystemBase.h"
+#include "../utils/SpatialGrid.h"
+#include <vector>
+
+/**
+ * @brief Per-frame spatial index of ship and planet positions
+ *
+ * Rebuilt once at the end of every update so rendering and input can ask
+ * which entities lie in a region without walking the whole registry. Ships
+ * and planets are kept in separate grids since callers almost always want
+ * one kind and planets are far fewer and larger.
+ */
+class SpatialIndexSystem : public SystemBase {
+public:
+    explicit SpatialIndexSystem(ECSRegistry& registry);
+    ~SpatialIndexSystem() override;
+
+    // SystemBase interface
+    bool Initialize() override;
+    void Update(float deltaTime) override;
+    void Shutdown() override;
+
+    /**
+     * @brief Append living ships whose center lies inside the rectangle
+     */
+    void QueryShips(float minX, float minY, float maxX, float maxY, std::vector<EntityID>& results) const;
+
+    /**
+     * @brief Append planets whose center lies inside the rectangle
+     */
+    void QueryPlanets(float minX, float minY, float maxX, float maxY, std::vector<EntityID>& results) const;
+
+    // Area covered by grid cells; positions outside still index into the border cells
+    static constexpr float INDEX_MIN_X = -4.0F;
+    static constexpr float INDEX_MIN_Y = -3.0F;
+    static constexpr float INDEX_MAX_X = 4.0F;
+    static constexpr float INDEX_MAX_Y = 3.0F;
+
+private:
+    SpatialGrid mShipGrid;
+    SpatialGrid mPlanetGrid;
+
+    static constexpr float SHIP_CELL_SIZE = 0.1F;
+    static constexpr float PLANET_CELL_SIZE = 0.5F;
+};
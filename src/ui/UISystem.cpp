@@ -1,11 +1,12 @@
 #include "UISystem.h"
 #include "../rendering/Renderer.h"
+#include "../core/EventBus.h"
 #include "../core/GameStateManager.h"
 #include <SDL2/SDL_log.h>
 #include <SDL2/SDL_mouse.h>
 #include <algorithm>
-#include <map>
 #include <cmath>
+#include <cstdio>
 #include <cstdlib>
 
 UISystem::UISystem(ECSRegistry& registry)
@@ -49,6 +50,33 @@ void UISystem::Shutdown() {
     SDL_Log("UI manager shutdown");
 }
 
+void UISystem::SetRenderer(Renderer* renderer) {
+    mRenderer = renderer;
+    if (mRenderer == nullptr) {
+        return;
+    }
+
+    mLabels.planetDestroyed = mRenderer->InternText("PLANET DESTROYED");
+    mLabels.cannotBuild = mRenderer->InternText("CANNOT BUILD");
+    mLabels.buildMenu = mRenderer->InternText("BUILD MENU");
+    mLabels.buttonFrame = mRenderer->InternText("[                ]");
+    mLabels.buildShip = mRenderer->InternText("[ BUILD SHIP ]");
+    mLabels.clickToBuild = mRenderer->InternText("Click to build");
+    mLabels.gameOver = mRenderer->InternText("GAME OVER");
+    mLabels.allPlanetsDestroyed = mRenderer->InternText("All planets destroyed!");
+    mLabels.returnToMenu = mRenderer->InternText("Press ESC to return to menu");
+}
+
+const std::string& UISystem::FormatCached(CachedText& cache, int value, const char* prefix, const char* suffix) {
+    if (cache.value != value || cache.text.empty()) {
+        cache.value = value;
+        cache.text.assign(prefix);
+        cache.text.append(std::to_string(value));
+        cache.text.append(suffix);
+    }
+    return cache.text;
+}
+
 void UISystem::RenderUI() {
     if (!mShowUI || mRenderer == nullptr) {
         return;
@@ -60,15 +88,30 @@ void UISystem::RenderUI() {
         return;
     }
     
-    RenderGameInfo();
+    // Panels are re-recorded only when their inputs change; otherwise the last recording is replayed
+    if (mGameInfoDirty || static_cast<int>(mGameTime) != mTimeText.value) {
+        RenderGameInfo();
+        mGameInfoDirty = false;
+    }
+    mRenderer->SubmitUIList(mGameInfoList);
     
     if (mSelectedPlanet != INVALID_ENTITY) {
-        RenderBuildInterface();
+        BuildPanelState state = GetBuildPanelState();
+        if (state != mBuildPanelState) {
+            mBuildPanelState = state;
+            RenderBuildInterface();
+        }
+        mRenderer->SubmitUIList(mBuildList);
     }
     
     // Render unit selection panel if units are selected
     if (mSelectedCount > 0) {
-        RenderUnitSelectionPanel();
+        if (mSelectionDirty) {
+            RefreshSelectedUnitGroups();
+            RenderUnitSelectionPanel();
+            mSelectionDirty = false;
+        }
+        mRenderer->SubmitUIList(mSelectionList);
     }
 }
 
@@ -81,7 +124,10 @@ void UISystem::UpdateGameTime(float gameTime) {
 }
 
 void UISystem::UpdateSelectedCount(int count) {
+    // Called whenever the selection changes, even if its size does not
     mSelectedCount = count;
+    mGameInfoDirty = true;
+    mSelectionDirty = true;
 }
 
 void UISystem::SetSelectedPlanet(EntityID planet) {
@@ -97,6 +143,23 @@ void UISystem::SetGameStateManager(GameStateManager* gameStateManager) {
     mGameStateManager = gameStateManager;
 }
 
+void UISystem::SetEventBus(EventBus* eventBus) {
+    mEventBus = eventBus;
+    if (mEventBus == nullptr) {
+        return;
+    }
+    
+    mEventBus->Subscribe(GameEventType::EntityDamaged, [this](const GameEvent& event) { OnEntityDamaged(event); });
+}
+
+void UISystem::OnEntityDamaged(const GameEvent& event) {
+    // Only selected units appear in the selection panel
+    auto* selectable = mRegistry.GetComponent<Components::Selectable>(event.entity);
+    if (selectable != nullptr && selectable->isSelected) {
+        mSelectionDirty = true;
+    }
+}
+
 void UISystem::HandleUIClick(int mouseX, int mouseY) {
     if (!IsClickInBuildInterface(mouseX, mouseY) || mSelectedPlanet == INVALID_ENTITY) {
         return;
@@ -151,15 +214,13 @@ bool UISystem::IsClickInBuildInterface(int mouseX, int mouseY) const {
 }
 
 void UISystem::RenderBuildInterface() {
-    if (mSelectedPlanet == INVALID_ENTITY) {
-        return;
-    }
-    
-    // Get planet component to check build queue
-    auto* planet = mRegistry.GetComponent<Components::Planet>(mSelectedPlanet);
-    auto* planetHealth = mRegistry.GetComponent<Components::Health>(mSelectedPlanet);
+    static const BatchColor DESTROYED = BatchColor::FromFloat(1.0F, 0.0F, 0.0F);
+    static const BatchColor TITLE = BatchColor::FromFloat(1.0F, 1.0F, 1.0F);
+    static const BatchColor PROGRESS = BatchColor::FromFloat(0.0F, 1.0F, 0.0F);
+    mBuildList.Clear();
     
-    if (planet == nullptr || !planet->isPlayerOwned) {
+    const BuildPanelState& state = mBuildPanelState;
+    if (state.planet == INVALID_ENTITY || !state.isPlayerOwned) {
         return;
     }
     
@@ -168,21 +229,20 @@ void UISystem::RenderBuildInterface() {
     float panelY = -0.5F;  // Adjusted so bottom borders align at same level
     constexpr float GRID_SIZE = 0.4F;
     constexpr float ICON_SIZE = 0.18F;  // Make icons larger to fill grid cells
-    constexpr float ICON_SPACING = 0.2F;  // Match grid cell size
     
     // Draw grid border using Renderer
-    mRenderer->DrawGridBorder(panelX, panelY, GRID_SIZE);
+    mRenderer->DrawGridBorder(mBuildList, panelX, panelY, GRID_SIZE);
     
     // Check if planet is destroyed
-    if (planetHealth == nullptr || !planetHealth->isAlive) {
+    if (!state.isAlive) {
         // Show destruction message instead of build options
-        mRenderer->RenderText("PLANET DESTROYED", panelX + 0.05F, panelY + 0.25F, 0.025F, 1.0F, 0.0F, 0.0F);
-        mRenderer->RenderText("CANNOT BUILD", panelX + 0.05F, panelY + 0.0F, 0.025F, 1.0F, 0.0F, 0.0F);
+        mBuildList.AddText(mLabels.planetDestroyed, panelX + 0.05F, panelY + 0.25F, 0.025F, DESTROYED);
+        mBuildList.AddText(mLabels.cannotBuild, panelX + 0.05F, panelY + 0.0F, 0.025F, DESTROYED);
         return;
     }
     
     // Draw title above the grid
-    mRenderer->RenderText("BUILD MENU", panelX + 0.05F, panelY + 0.25F, 0.025F, 1.0F, 1.0F, 1.0F);
+    mBuildList.AddText(mLabels.buildMenu, panelX + 0.05F, panelY + 0.25F, 0.025F, TITLE);
     
     // Center icons in grid cells - align with grid lines
     float cellSize = GRID_SIZE / 2;  // 2x2 grid
@@ -190,25 +250,43 @@ void UISystem::RenderBuildInterface() {
     float startY = panelY + cellSize/2;  // Center of first cell
     
     // Icon 1: Spacecraft (top-left cell)
-    int spacecraftQueueCount = GetBuildQueueCount(mSelectedPlanet, Components::BuildableUnit::Spacecraft);
-    mRenderer->RenderBuildIcon(startX, startY, ICON_SIZE, Components::BuildableUnit::Spacecraft, spacecraftQueueCount);
+    mRenderer->RenderBuildIcon(mBuildList, startX, startY, ICON_SIZE, Components::BuildableUnit::Spacecraft, state.queueCount);
     
     // Icon 2: Reserved for future units (top-right cell)
-    mRenderer->RenderEmptyIcon(startX + cellSize, startY, ICON_SIZE);
+    mRenderer->RenderEmptyIcon(mBuildList, startX + cellSize, startY, ICON_SIZE);
     
     // Icon 3: Reserved for future units (bottom-left cell)
-    mRenderer->RenderEmptyIcon(startX, startY - cellSize, ICON_SIZE);
+    mRenderer->RenderEmptyIcon(mBuildList, startX, startY - cellSize, ICON_SIZE);
     
     // Icon 4: Reserved for future units (bottom-right cell)
-    mRenderer->RenderEmptyIcon(startX + cellSize, startY - cellSize, ICON_SIZE);
+    mRenderer->RenderEmptyIcon(mBuildList, startX + cellSize, startY - cellSize, ICON_SIZE);
     
     // Show build progress below the grid
+    if (state.progress >= 0) {
+        const std::string& progressText = FormatCached(mProgressText, state.progress, "Building: ", "%");
+        mBuildList.AddText(progressText, panelX + 0.05F, panelY - 0.25F, 0.025F, PROGRESS);
+    }
+}
+
+UISystem::BuildPanelState UISystem::GetBuildPanelState() const {
+    BuildPanelState state;
+    state.planet = mSelectedPlanet;
+    
+    auto* planet = mRegistry.GetComponent<Components::Planet>(mSelectedPlanet);
+    if (planet == nullptr || !planet->isPlayerOwned) {
+        return state;
+    }
+    
+    auto* planetHealth = mRegistry.GetComponent<Components::Health>(mSelectedPlanet);
+    state.isPlayerOwned = true;
+    state.isAlive = planetHealth != nullptr && planetHealth->isAlive;
+    state.queueCount = GetBuildQueueCount(mSelectedPlanet, Components::BuildableUnit::Spacecraft);
     if (!planet->buildQueue.empty()) {
-        auto& currentBuild = planet->buildQueue.front();
+        const auto& currentBuild = planet->buildQueue.front();
         float progress = (currentBuild.totalBuildTime - currentBuild.timeRemaining) / currentBuild.totalBuildTime * 100.0F;
-        std::string progressText = "Building: " + std::to_string(static_cast<int>(progress)) + "%";
-        mRenderer->RenderText(progressText, panelX + 0.05F, panelY - 0.25F, 0.025F, 0.0F, 1.0F, 0.0F);
+        state.progress = static_cast<int>(progress);
     }
+    return state;
 }
 
 void UISystem::RenderBuildButton(float posX, float posY, float width, float height, 
@@ -218,33 +296,32 @@ void UISystem::RenderBuildButton(float posX, float posY, float width, float heig
     }
     
     // Render button background using text characters
-    mRenderer->RenderText("[                ]", posX - 0.05F, posY, 0.04F, 0.5F, 0.5F, 0.5F);
+    mRenderer->RenderText(mLabels.buttonFrame, posX - 0.05F, posY, 0.04F, 0.5F, 0.5F, 0.5F);
     
     // Render button icon/text
-    mRenderer->RenderText("[ BUILD SHIP ]", posX, posY, 0.035F, 1.0F, 1.0F, 1.0F);
+    mRenderer->RenderText(mLabels.buildShip, posX, posY, 0.035F, 1.0F, 1.0F, 1.0F);
     
     // Render queue count prominently
     if (queueCount > 0) {
-        std::string queueText = "Queue: " + std::to_string(queueCount);
+        const std::string& queueText = FormatCached(mQueueText, queueCount, "Queue: ");
         mRenderer->RenderText(queueText, posX, posY - 0.08F, 0.03F, 1.0F, 1.0F, 0.0F);
     }
     
     // Add instructions
-    mRenderer->RenderText("Click to build", posX, posY - 0.15F, 0.025F, 0.7F, 0.7F, 0.7F);
+    mRenderer->RenderText(mLabels.clickToBuild, posX, posY - 0.15F, 0.025F, 0.7F, 0.7F, 0.7F);
 }
 
 void UISystem::RenderGameInfo() {
-    if (mRenderer == nullptr) {
-        return;
-    }
+    static const BatchColor TEXT_COLOR = BatchColor::FromFloat(1.0F, 1.0F, 1.0F);
+    mGameInfoList.Clear();
     
     // Render game time and selected count in top-left
-    std::string timeText = "Time: " + std::to_string(static_cast<int>(mGameTime));
-    mRenderer->RenderText(timeText, -0.95F, 0.9F, UI_TEXT_SIZE, 1.0F, 1.0F, 1.0F);
+    const std::string& timeText = FormatCached(mTimeText, static_cast<int>(mGameTime), "Time: ");
+    mGameInfoList.AddText(timeText, -0.95F, 0.9F, UI_TEXT_SIZE, TEXT_COLOR);
     
     if (mSelectedCount > 0) {
-        std::string selectionText = "Selected: " + std::to_string(mSelectedCount);
-        mRenderer->RenderText(selectionText, -0.95F, 0.85F, UI_TEXT_SIZE, 1.0F, 1.0F, 1.0F);
+        const std::string& selectionText = FormatCached(mSelectionText, mSelectedCount, "Selected: ");
+        mGameInfoList.AddText(selectionText, -0.95F, 0.85F, UI_TEXT_SIZE, TEXT_COLOR);
     }
 }
 
@@ -313,13 +390,17 @@ void UISystem::CompleteBuild(EntityID planet, Components::BuildableUnit unitType
         mRegistry.AddComponent<Components::Selectable>(newShip, {false, 0.04F}); // Original size
         mRegistry.AddComponent<Components::Renderable>(newShip, {1.0F, 0.8F, 0.2F, 1.0F, 1.0F});
         
+        if (mEventBus != nullptr) {
+            mEventBus->Publish({GameEventType::EntitySpawned, newShip, spawnX, spawnY});
+        }
+        
         SDL_Log("Spacecraft built and deployed from planet %u", planet);
     }
 }
 
 void UISystem::RenderUnitSelectionPanel() {
-    auto selectedGroups = GetSelectedUnitGroups();
-    if (selectedGroups.empty()) {
+    mSelectionList.Clear();
+    if (mSelectedGroups.empty()) {
         return;
     }
         
@@ -331,27 +412,26 @@ void UISystem::RenderUnitSelectionPanel() {
     constexpr float ICON_SPACING = 0.15F;
     
     // Render panel background
-    mRenderer->RenderUnitSelectionPanel(0.0F, PANEL_Y, PANEL_WIDTH, PANEL_HEIGHT);
+    mRenderer->RenderUnitSelectionPanel(mSelectionList, 0.0F, PANEL_Y, PANEL_WIDTH, PANEL_HEIGHT);
     
     // Calculate starting position for icons (centered)
-    float totalWidth = static_cast<float>(selectedGroups.size()) * ICON_SPACING;
+    float totalWidth = static_cast<float>(mSelectedGroups.size()) * ICON_SPACING;
     float startX = -totalWidth / 2.0F + ICON_SPACING / 2.0F;
     
     // Render unit icons
-    for (size_t i = 0; i < selectedGroups.size(); ++i) {
-        const auto& group = selectedGroups[i];
+    for (size_t i = 0; i < mSelectedGroups.size(); ++i) {
+        const auto& group = mSelectedGroups[i];
         float iconX = startX + static_cast<float>(i) * ICON_SPACING;
-        mRenderer->RenderSelectedUnitIcon(iconX, PANEL_Y, ICON_SIZE, group.unitType, group.count, group.averageHealth);
+        mRenderer->RenderSelectedUnitIcon(mSelectionList, iconX, PANEL_Y, ICON_SIZE, group.unitType, group.count, group.averageHealth);
     }
 }
 
-std::vector<UISystem::SelectedUnitGroup> UISystem::GetSelectedUnitGroups() const {
-    std::vector<SelectedUnitGroup> groups;
-    std::map<Components::SpacecraftType, SelectedUnitGroup> groupMap;
+void UISystem::RefreshSelectedUnitGroups() {
+    mSelectedGroups.clear();
     
     using namespace Components;
     
-    // Iterate through all spacecraft to find selected ones
+    // Iterate through all spacecraft to find selected ones; only runs when the selection or its health changed
     mRegistry.ForEach<Spacecraft>([&](EntityID entity, const Spacecraft& spacecraft) {
         auto* selectable = mRegistry.GetComponent<Selectable>(entity);
         auto* health = mRegistry.GetComponent<Health>(entity);
@@ -360,32 +440,24 @@ std::vector<UISystem::SelectedUnitGroup> UISystem::GetSelectedUnitGroups() const
             return;
         }
         
-        // Find or create group for this unit type
-        auto it = groupMap.find(spacecraft.type);
-        if (it == groupMap.end()) {
-            SelectedUnitGroup newGroup;
-            newGroup.unitType = spacecraft.type;
-            newGroup.count = 1;
-            newGroup.averageHealth = static_cast<float>(health->currentHP) / static_cast<float>(health->maxHP);
-            groupMap[spacecraft.type] = newGroup;
+        float healthPercent = static_cast<float>(health->currentHP) / static_cast<float>(health->maxHP);
+        
+        // Find or create group for this unit type; there are only a couple of types
+        auto it = std::find_if(mSelectedGroups.begin(), mSelectedGroups.end(),
+            [&](const SelectedUnitGroup& group) { return group.unitType == spacecraft.type; });
+        if (it == mSelectedGroups.end()) {
+            mSelectedGroups.push_back({spacecraft.type, 1, healthPercent});
         } else {
-            // Update existing group
-            float currentAverage = it->second.averageHealth;
-            int currentCount = it->second.count;
-            float newHealthPercent = static_cast<float>(health->currentHP) / static_cast<float>(health->maxHP);
-            
-            // Calculate new average health
-            it->second.averageHealth = (currentAverage * static_cast<float>(currentCount) + newHealthPercent) / static_cast<float>(currentCount + 1);
-            it->second.count++;
+            // Update running average health
+            float currentCount = static_cast<float>(it->count);
+            it->averageHealth = (it->averageHealth * currentCount + healthPercent) / (currentCount + 1.0F);
+            it->count++;
         }
     });
     
-    // Convert map to vector
-    for (const auto& pair : groupMap) {
-        groups.push_back(pair.second);
-    }
-    
-    return groups;
+    // Keep a stable type order
+    std::sort(mSelectedGroups.begin(), mSelectedGroups.end(),
+        [](const SelectedUnitGroup& lhs, const SelectedUnitGroup& rhs) { return lhs.unitType < rhs.unitType; });
 }
 
 void UISystem::RenderGameOverScreen() {
@@ -398,37 +470,41 @@ void UISystem::RenderGameOverScreen() {
         return;
     }
     
-    // Render dark overlay using the UI panel renderer
-    mRenderer->RenderUnitSelectionPanel(0.0F, 0.0F, 2.0F, 1.5F);
-    
-    // Game Over title
-    mRenderer->RenderText("GAME OVER", -0.2F, 0.3F, 0.08F, 1.0F, 0.2F, 0.2F);
-    
-    // Defeat message
-    mRenderer->RenderText("All planets destroyed!", -0.25F, 0.15F, 0.04F, 1.0F, 1.0F, 1.0F);
-    
-    // Game statistics
-    char statsText[256];
-    
-    // Survival time
-    float survivalTime = mGameStateManager->GetGameTime();
-    int minutes = static_cast<int>(survivalTime) / 60;
-    int seconds = static_cast<int>(survivalTime) % 60;
-    snprintf(statsText, sizeof(statsText), "Survival Time: %d:%02d", minutes, seconds);
-    mRenderer->RenderText(statsText, -0.15F, 0.0F, 0.03F, 0.8F, 0.8F, 0.8F);
-    
-    // Score
-    snprintf(statsText, sizeof(statsText), "Final Score: %u", mGameStateManager->GetScore());
-    mRenderer->RenderText(statsText, -0.15F, -0.05F, 0.03F, 0.8F, 0.8F, 0.8F);
-    
-    // Enemies killed
-    snprintf(statsText, sizeof(statsText), "Enemies Defeated: %u", mGameStateManager->GetEnemiesKilled());
-    mRenderer->RenderText(statsText, -0.15F, -0.1F, 0.03F, 0.8F, 0.8F, 0.8F);
-    
-    // Wave reached
-    snprintf(statsText, sizeof(statsText), "Wave Reached: %u", mGameStateManager->GetWaveNumber());
-    mRenderer->RenderText(statsText, -0.15F, -0.15F, 0.03F, 0.8F, 0.8F, 0.8F);
+    // The statistics are frozen once the game ends, so this is normally recorded once
+    int survivalSeconds = static_cast<int>(mGameStateManager->GetGameTime());
+    int score = static_cast<int>(mGameStateManager->GetScore());
+    int kills = static_cast<int>(mGameStateManager->GetEnemiesKilled());
+    int wave = static_cast<int>(mGameStateManager->GetWaveNumber());
+    bool statsChanged = survivalSeconds != mSurvivalText.value || score != mScoreText.value ||
+                        kills != mKillsText.value || wave != mWaveText.value;
+    
+    if (statsChanged) {
+        static const BatchColor TITLE = BatchColor::FromFloat(1.0F, 0.2F, 0.2F);
+        static const BatchColor MESSAGE = BatchColor::FromFloat(1.0F, 1.0F, 1.0F);
+        static const BatchColor STATS = BatchColor::FromFloat(0.8F, 0.8F, 0.8F);
+        static const BatchColor HINT = BatchColor::FromFloat(0.6F, 0.6F, 0.6F);
+        mGameOverList.Clear();
+        
+        // Render dark overlay using the UI panel renderer
+        mRenderer->RenderUnitSelectionPanel(mGameOverList, 0.0F, 0.0F, 2.0F, 1.5F);
+        
+        // Game Over title and defeat message
+        mGameOverList.AddText(mLabels.gameOver, -0.2F, 0.3F, 0.08F, TITLE);
+        mGameOverList.AddText(mLabels.allPlanetsDestroyed, -0.25F, 0.15F, 0.04F, MESSAGE);
+        
+        // Game statistics
+        char statsText[64];
+        snprintf(statsText, sizeof(statsText), "Survival Time: %d:%02d", survivalSeconds / 60, survivalSeconds % 60);
+        mSurvivalText.value = survivalSeconds;
+        mSurvivalText.text = statsText;
+        mGameOverList.AddText(mSurvivalText.text, -0.15F, 0.0F, 0.03F, STATS);
+        mGameOverList.AddText(FormatCached(mScoreText, score, "Final Score: "), -0.15F, -0.05F, 0.03F, STATS);
+        mGameOverList.AddText(FormatCached(mKillsText, kills, "Enemies Defeated: "), -0.15F, -0.1F, 0.03F, STATS);
+        mGameOverList.AddText(FormatCached(mWaveText, wave, "Wave Reached: "), -0.15F, -0.15F, 0.03F, STATS);
+        
+        // Instructions
+        mGameOverList.AddText(mLabels.returnToMenu, -0.2F, -0.3F, 0.025F, HINT);
+    }
     
-    // Instructions
-    mRenderer->RenderText("Press ESC to return to menu", -0.2F, -0.3F, 0.025F, 0.6F, 0.6F, 0.6F);
+    mRenderer->SubmitUIList(mGameOverList);
 }
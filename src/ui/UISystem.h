@@ -3,13 +3,23 @@
 #include "../core/ECSRegistry.h"
 #include "../core/SystemBase.h"
 #include "../components/Components.h"
+#include "../rendering/TextRenderer.h"
+#include "../rendering/UIDrawList.h"
+#include <string>
 #include <vector>
 
 // Forward declarations
 class Renderer;
+class EventBus;
+struct GameEvent;
 
 /**
  * @brief UI system with build interface
+ *
+ * Each panel is recorded into a retained draw list and re-recorded only when
+ * something it shows changes: the selection, the selected planet's build
+ * queue and progress, the whole-second game time, or the health of a
+ * selected unit. Other frames replay the recorded lists.
  */
 class UISystem : public SystemBase {
 public:
@@ -24,7 +34,7 @@ public:
     // UI rendering
     void RenderUI();
     void RenderGameOverScreen();
-    void SetRenderer(Renderer* renderer) { mRenderer = renderer; }
+    void SetRenderer(Renderer* renderer);
 
     // UI state management  
     void ShowGameUI(bool show);
@@ -32,6 +42,8 @@ public:
     void UpdateSelectedCount(int count);
     void SetSelectedPlanet(EntityID planet);
     void SetGameStateManager(class GameStateManager* gameStateManager);
+    // Subscribe to damage events that change the selected units' health bars
+    void SetEventBus(EventBus* eventBus);
 
     // UI queries
     bool IsUIVisible() const { return mShowUI; }
@@ -57,13 +69,46 @@ private:
         int count;
         float averageHealth;
     };
-    std::vector<SelectedUnitGroup> GetSelectedUnitGroups() const;
+    void RefreshSelectedUnitGroups();
+    void OnEntityDamaged(const GameEvent& event);
+    
+    // Everything the build panel displays; it is re-recorded when this changes
+    struct BuildPanelState {
+        EntityID planet = INVALID_ENTITY;
+        bool isPlayerOwned = false;
+        bool isAlive = false;
+        int queueCount = 0;
+        int progress = -1; // Whole percent of the current build, -1 when idle
+        
+        bool operator==(const BuildPanelState&) const = default;
+    };
+    BuildPanelState GetBuildPanelState() const;
     
     // Build queue management
     void AddToBuildQueue(EntityID planet, Components::BuildableUnit unitType);
     int GetBuildQueueCount(EntityID planet, Components::BuildableUnit unitType) const;
     void CompleteBuild(EntityID planet, Components::BuildableUnit unitType);
 
+    // Text that is only reformatted when the value it shows changes
+    struct CachedText {
+        int value = -1;
+        std::string text;
+    };
+    static const std::string& FormatCached(CachedText& cache, int value, const char* prefix, const char* suffix = "");
+
+    // Static labels, interned when the renderer is attached
+    struct Labels {
+        TextId planetDestroyed = TextRenderer::INVALID_TEXT;
+        TextId cannotBuild = TextRenderer::INVALID_TEXT;
+        TextId buildMenu = TextRenderer::INVALID_TEXT;
+        TextId buttonFrame = TextRenderer::INVALID_TEXT;
+        TextId buildShip = TextRenderer::INVALID_TEXT;
+        TextId clickToBuild = TextRenderer::INVALID_TEXT;
+        TextId gameOver = TextRenderer::INVALID_TEXT;
+        TextId allPlanetsDestroyed = TextRenderer::INVALID_TEXT;
+        TextId returnToMenu = TextRenderer::INVALID_TEXT;
+    };
+
     // UI state
     bool mShowUI;
     float mGameTime;
@@ -71,6 +116,28 @@ private:
     EntityID mSelectedPlanet;
     Renderer* mRenderer = nullptr;
     class GameStateManager* mGameStateManager = nullptr;
+    EventBus* mEventBus = nullptr;
+
+    // Text drawing state
+    Labels mLabels;
+    CachedText mProgressText;
+    CachedText mQueueText;
+    CachedText mTimeText;
+    CachedText mSelectionText;
+    CachedText mSurvivalText;
+    CachedText mScoreText;
+    CachedText mKillsText;
+    CachedText mWaveText;
+    
+    // Retained panels and the inputs they were recorded from
+    UIDrawList mGameInfoList;
+    UIDrawList mBuildList;
+    UIDrawList mSelectionList;
+    UIDrawList mGameOverList;
+    bool mGameInfoDirty = true;
+    bool mSelectionDirty = true;
+    BuildPanelState mBuildPanelState;
+    std::vector<SelectedUnitGroup> mSelectedGroups;
     
     // UI layout constants
     static constexpr float UI_MARGIN = 0.02F;
@@ -0,0 +1,116 @@
+#include "FormationPlanner.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+namespace {
+    constexpr int HEX_SIDES = 6;
+    constexpr float PI = 3.14159265F;
+
+    FormationPlanner::Point Centroid(const std::vector<FormationPlanner::Point>& points, std::size_t count) {
+        FormationPlanner::Point center;
+        if (count == 0) {
+            return center;
+        }
+
+        for (std::size_t i = 0; i < count; ++i) {
+            center.posX += points[i].posX;
+            center.posY += points[i].posY;
+        }
+        center.posX /= static_cast<float>(count);
+        center.posY /= static_cast<float>(count);
+        return center;
+    }
+}
+
+std::vector<FormationPlanner::Point> FormationPlanner::ComputeSlots(std::size_t count, float centerX, float centerY, float spacing) {
+    std::vector<Point> slots;
+    slots.reserve(count);
+    if (count == 0) {
+        return slots;
+    }
+
+    slots.push_back({centerX, centerY});
+
+    // Ring k is a hexagon of radius k * spacing holding 6k evenly spaced slots
+    for (int ring = 1; slots.size() < count; ++ring) {
+        float ringRadius = static_cast<float>(ring) * spacing;
+
+        for (int side = 0; side < HEX_SIDES && slots.size() < count; ++side) {
+            float cornerAngle = static_cast<float>(side) * (PI / 3.0F);
+            float nextAngle = static_cast<float>(side + 1) * (PI / 3.0F);
+            float cornerX = std::cos(cornerAngle) * ringRadius;
+            float cornerY = std::sin(cornerAngle) * ringRadius;
+            float edgeX = (std::cos(nextAngle) * ringRadius) - cornerX;
+            float edgeY = (std::sin(nextAngle) * ringRadius) - cornerY;
+
+            for (int step = 0; step < ring && slots.size() < count; ++step) {
+                float t = static_cast<float>(step) / static_cast<float>(ring);
+                slots.push_back({centerX + cornerX + (edgeX * t), centerY + cornerY + (edgeY * t)});
+            }
+        }
+    }
+
+    return slots;
+}
+
+std::vector<std::size_t> FormationPlanner::AssignSlots(const std::vector<Point>& units, const std::vector<Point>& slots) {
+    std::vector<std::size_t> assignment(units.size(), 0);
+    if (units.empty() || slots.size() < units.size()) {
+        return assignment;
+    }
+
+    Point unitCenter = Centroid(units, units.size());
+    Point slotCenter = Centroid(slots, units.size());
+
+    // Outermost units choose first
+    std::vector<std::size_t> order(units.size());
+    std::iota(order.begin(), order.end(), 0);
+    auto offsetSq = [&](std::size_t unit) {
+        float deltaX = units[unit].posX - unitCenter.posX;
+        float deltaY = units[unit].posY - unitCenter.posY;
+        return (deltaX * deltaX) + (deltaY * deltaY);
+    };
+    std::sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) {
+        return offsetSq(a) > offsetSq(b);
+    });
+
+    std::vector<bool> taken(slots.size(), false);
+    for (std::size_t unit : order) {
+        float unitOffsetX = units[unit].posX - unitCenter.posX;
+        float unitOffsetY = units[unit].posY - unitCenter.posY;
+        float bestDistanceSq = std::numeric_limits<float>::max();
+        std::size_t bestSlot = 0;
+
+        for (std::size_t slot = 0; slot < slots.size(); ++slot) {
+            if (taken[slot]) {
+                continue;
+            }
+
+            float deltaX = (slots[slot].posX - slotCenter.posX) - unitOffsetX;
+            float deltaY = (slots[slot].posY - slotCenter.posY) - unitOffsetY;
+            float distanceSq = (deltaX * deltaX) + (deltaY * deltaY);
+            if (distanceSq < bestDistanceSq) {
+                bestDistanceSq = distanceSq;
+                bestSlot = slot;
+            }
+        }
+
+        taken[bestSlot] = true;
+        assignment[unit] = bestSlot;
+    }
+
+    return assignment;
+}
+
+float FormationPlanner::FormationRadius(std::size_t count, float spacing) {
+    // Rings 0..k hold 1 + 3k(k+1) slots
+    int ring = 0;
+    std::size_t capacity = 1;
+    while (capacity < count) {
+        ++ring;
+        capacity += static_cast<std::size_t>(HEX_SIDES * ring);
+    }
+    return static_cast<float>(ring) * spacing;
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief Computes formation slots for group move orders
+ *
+ * Slots are laid out as hexagonal rings around the destination with spacing
+ * wider than the ship separation radius, so ships that reach their slots
+ * stop pushing each other apart.
+ */
+class FormationPlanner {
+public:
+    struct Point {
+        float posX = 0.0F;
+        float posY = 0.0F;
+    };
+
+    /**
+     * @brief Generate slot positions around a destination
+     * @param count Number of slots needed
+     * @param centerX Destination X in world space
+     * @param centerY Destination Y in world space
+     * @param spacing Distance between neighboring slots
+     * @return Slot positions, innermost ring first
+     */
+    static std::vector<Point> ComputeSlots(std::size_t count, float centerX, float centerY, float spacing);
+
+    /**
+     * @brief Greedily assign units to slots
+     *
+     * Units and slots are compared relative to their own centroids so the
+     * group keeps its shape and paths rarely cross. Units farthest from the
+     * group center pick first since they have the fewest good options.
+     *
+     * @param units Current unit positions
+     * @param slots Slot positions (at least as many as units)
+     * @return Slot index for each unit
+     */
+    static std::vector<std::size_t> AssignSlots(const std::vector<Point>& units, const std::vector<Point>& slots);
+
+    /**
+     * @brief Radius of the ring layout produced for a given count
+     */
+    static float FormationRadius(std::size_t count, float spacing);
+};
@@ -0,0 +1,84 @@
+#include "SpatialGrid.h"
+#include <algorithm>
+#include <cmath>
+
+SpatialGrid::SpatialGrid(float minX, float minY, float maxX, float maxY, float cellSize)
+    : mMinX(minX)
+    , mMinY(minY)
+    , mInverseCellSize(1.0F / cellSize)
+    , mWidth(std::max(1, static_cast<int>(std::ceil((maxX - minX) / cellSize))))
+    , mHeight(std::max(1, static_cast<int>(std::ceil((maxY - minY) / cellSize))))
+    , mStaged()
+    , mEntries()
+    , mCellStart(static_cast<std::size_t>(mWidth * mHeight) + 1, 0)
+    , mEntryCell()
+    , mCellCursor()
+{
+}
+
+void SpatialGrid::Clear() {
+    mStaged.clear();
+    mEntries.clear();
+    mEntryCell.clear();
+    std::fill(mCellStart.begin(), mCellStart.end(), 0);
+}
+
+void SpatialGrid::Insert(EntityID entity, float posX, float posY) {
+    mStaged.push_back({entity, posX, posY});
+}
+
+void SpatialGrid::Build() {
+    std::fill(mCellStart.begin(), mCellStart.end(), 0);
+
+    // Count entries per cell, shifted by one so the prefix sum yields start offsets
+    mEntryCell.resize(mStaged.size());
+    for (std::size_t i = 0; i < mStaged.size(); ++i) {
+        auto cell = static_cast<std::uint32_t>((CellY(mStaged[i].posY) * mWidth) + CellX(mStaged[i].posX));
+        mEntryCell[i] = cell;
+        ++mCellStart[cell + 1];
+    }
+
+    for (std::size_t cell = 1; cell < mCellStart.size(); ++cell) {
+        mCellStart[cell] += mCellStart[cell - 1];
+    }
+
+    // Scatter into place, advancing a write cursor per cell
+    mCellCursor.assign(mCellStart.begin(), mCellStart.end() - 1);
+    mEntries.resize(mStaged.size());
+    for (std::size_t i = 0; i < mStaged.size(); ++i) {
+        mEntries[mCellCursor[mEntryCell[i]]++] = mStaged[i];
+    }
+
+    mStaged.clear();
+}
+
+void SpatialGrid::Query(float minX, float minY, float maxX, float maxY, std::vector<EntityID>& results) const {
+    int firstX = CellX(minX);
+    int lastX = CellX(maxX);
+    int firstY = CellY(minY);
+    int lastY = CellY(maxY);
+
+    for (int cellY = firstY; cellY <= lastY; ++cellY) {
+        std::size_t rowStart = static_cast<std::size_t>(cellY) * static_cast<std::size_t>(mWidth);
+        std::uint32_t begin = mCellStart[rowStart + static_cast<std::size_t>(firstX)];
+        std::uint32_t end = mCellStart[rowStart + static_cast<std::size_t>(lastX) + 1];
+
+        // Cells in a row are adjacent in the sorted array, so the row span is one range
+        for (std::uint32_t i = begin; i < end; ++i) {
+            const Entry& entry = mEntries[i];
+            if (entry.posX >= minX && entry.posX <= maxX && entry.posY >= minY && entry.posY <= maxY) {
+                results.push_back(entry.entity);
+            }
+        }
+    }
+}
+
+int SpatialGrid::CellX(float posX) const {
+    int cell = static_cast<int>(std::floor((posX - mMinX) * mInverseCellSize));
+    return std::clamp(cell, 0, mWidth - 1);
+}
+
+int SpatialGrid::CellY(float posY) const {
+    int cell = static_cast<int>(std::floor((posY - mMinY) * mInverseCellSize));
+    return std::clamp(cell, 0, mHeight - 1);
+}
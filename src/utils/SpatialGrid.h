@@ -0,0 +1,64 @@
+#pragma once
+
+#include "../core/ECSRegistry.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Uniform grid of entity positions rebuilt from scratch each frame
+ *
+ * Entries are staged with Insert and bucketed by Build into one contiguous
+ * array sorted by cell (a counting sort), so a rebuild reuses the same
+ * storage every frame and a query walks a few short contiguous ranges.
+ * Positions outside the grid bounds are clamped into the border cells, so
+ * they are still found, just less selectively.
+ */
+class SpatialGrid {
+public:
+    struct Entry {
+        EntityID entity;
+        float posX;
+        float posY;
+    };
+
+    SpatialGrid(float minX, float minY, float maxX, float maxY, float cellSize);
+
+    /**
+     * @brief Drop all entries, keeping allocated storage
+     */
+    void Clear();
+
+    /**
+     * @brief Stage an entry; it becomes queryable after Build
+     */
+    void Insert(EntityID entity, float posX, float posY);
+
+    /**
+     * @brief Bucket staged entries by cell
+     */
+    void Build();
+
+    /**
+     * @brief Append entities whose position lies inside the rectangle
+     */
+    void Query(float minX, float minY, float maxX, float maxY, std::vector<EntityID>& results) const;
+
+    std::size_t Size() const { return mEntries.size(); }
+
+private:
+    int CellX(float posX) const;
+    int CellY(float posY) const;
+
+    float mMinX;
+    float mMinY;
+    float mInverseCellSize;
+    int mWidth;
+    int mHeight;
+
+    std::vector<Entry> mStaged;
+    std::vector<Entry> mEntries;          // Sorted by cell after Build
+    std::vector<std::uint32_t> mCellStart; // Cell c occupies [mCellStart[c], mCellStart[c + 1])
+    std::vector<std::uint32_t> mEntryCell; // Cell of each staged entry
+    std::vector<std::uint32_t> mCellCursor; // Next free slot per cell while scattering
+};
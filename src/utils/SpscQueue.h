@@ -0,0 +1,70 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+/**
+ * @brief Fixed-capacity lock-free queue for one producer and one consumer thread
+ *
+ * The producer only writes the tail and the consumer only writes the head,
+ * so neither side ever blocks or allocates; a push onto a full queue fails
+ * instead. Each index lives on its own cache line, and each side keeps a
+ * cached copy of the other's index so the shared line is only re-read when
+ * the queue looks full or empty.
+ */
+template<typename T, std::size_t Capacity>
+class SpscQueue {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    /**
+     * @brief Producer side: enqueue a copy of value
+     * @return false if the queue is full
+     */
+    bool TryPush(const T& value) {
+        std::size_t tail = mTail.load(std::memory_order_relaxed);
+        if (tail - mCachedHead == Capacity) {
+            mCachedHead = mHead.load(std::memory_order_acquire);
+            if (tail - mCachedHead == Capacity) {
+                return false;
+            }
+        }
+
+        mSlots[tail & MASK] = value;
+        mTail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Consumer side: dequeue the oldest value
+     * @return false if the queue is empty
+     */
+    bool TryPop(T& value) {
+        std::size_t head = mHead.load(std::memory_order_relaxed);
+        if (head == mCachedTail) {
+            mCachedTail = mTail.load(std::memory_order_acquire);
+            if (head == mCachedTail) {
+                return false;
+            }
+        }
+
+        value = mSlots[head & MASK];
+        mHead.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    static constexpr std::size_t MASK = Capacity - 1;
+    static constexpr std::size_t CACHE_LINE = 64;
+
+    std::array<T, Capacity> mSlots{};
+
+    // Consumer-owned
+    alignas(CACHE_LINE) std::atomic<std::size_t> mHead{0};
+    std::size_t mCachedTail = 0;
+
+    // Producer-owned
+    alignas(CACHE_LINE) std::atomic<std::size_t> mTail{0};
+    std::size_t mCachedHead = 0;
+};